@@ -0,0 +1,86 @@
+#include "benchmark.hpp"
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include "input-struct.hpp"
+
+namespace
+{
+  using Rational = std::pair< long long, unsigned long long >;
+
+  constexpr size_t RATIONAL_COUNT = 200000;
+
+  std::string makeRationals()
+  {
+    const char* const literals[] = {
+      "(:N -1:D 2:)",
+      "(:N 123456789:D 987654321:)",
+      "( : N  -42 : D 7 : )",
+      "(:N 0:D 1:)",
+      "(:N -9223372036854775808:D 18446744073709551615:)",
+      "(:N 5:D x:)"
+    };
+    std::string text;
+    for (size_t i = 0; i < RATIONAL_COUNT; ++i)
+    {
+      text += literals[i % (sizeof(literals) / sizeof(*literals))];
+      text += '\n';
+    }
+    return text;
+  }
+
+  std::istream& readChained(std::istream& in, Rational& dest)
+  {
+    using namespace aleksandrov;
+    in >> DelimeterI{ '(' } >> DelimeterI{ ':' };
+    in >> DelimeterI{ 'N' } >> LongLongI{ dest.first } >> DelimeterI{ ':' };
+    in >> DelimeterI{ 'D' } >> UnsignedLongLongI{ dest.second } >> DelimeterI{ ':' };
+    return in >> DelimeterI{ ')' };
+  }
+
+  std::istream& readFused(std::istream& in, Rational& dest)
+  {
+    return in >> aleksandrov::RationalI{ dest };
+  }
+
+  template< class Read >
+  double measure(const std::string& text, Read read, size_t& checksum)
+  {
+    using clock = std::chrono::steady_clock;
+    std::istringstream in(text);
+    auto start = clock::now();
+    while (!in.eof())
+    {
+      Rational value{ 0, 0 };
+      if (read(in, value))
+      {
+        checksum += static_cast< size_t >(value.first) ^ static_cast< size_t >(value.second);
+        checksum += static_cast< size_t >(in.tellg());
+      }
+      else
+      {
+        in.clear();
+        in.ignore(1);
+      }
+    }
+    std::chrono::duration< double, std::nano > elapsed = clock::now() - start;
+    return elapsed.count() / RATIONAL_COUNT;
+  }
+}
+
+namespace aleksandrov
+{
+  void benchmarkRationals(std::ostream& out)
+  {
+    std::string text = makeRationals();
+    size_t chainedSum = 0;
+    size_t fusedSum = 0;
+    double chainedTime = measure(text, readChained, chainedSum);
+    double fusedTime = measure(text, readFused, fusedSum);
+    out << "rational, chained extractors: " << chainedTime << " ns\n";
+    out << "rational, fused decoder:      " << fusedTime << " ns\n";
+    out << (chainedSum == fusedSum ? "results match\n" : "<RESULTS MISMATCH>\n");
+  }
+}
@@ -0,0 +1,11 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <iosfwd>
+
+namespace aleksandrov
+{
+  void benchmarkRationals(std::ostream&);
+}
+
+#endif
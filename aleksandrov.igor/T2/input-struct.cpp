@@ -1,5 +1,86 @@
 #include "input-struct.hpp"
 #include "stream-guard.hpp"
+#include <cctype>
+#include <limits>
+#include <string>
+
+namespace
+{
+  struct ByteCursor
+  {
+    std::streambuf& buf;
+    bool isEof = false;
+
+    int peek()
+    {
+      int c = buf.sgetc();
+      isEof = isEof || c == std::char_traits< char >::eof();
+      return c;
+    }
+
+    bool skipSpaces()
+    {
+      int c = peek();
+      while (!isEof && std::isspace(c))
+      {
+        c = buf.snextc();
+        isEof = c == std::char_traits< char >::eof();
+      }
+      return !isEof;
+    }
+
+    bool expect(char exp)
+    {
+      if (!skipSpaces())
+      {
+        return false;
+      }
+      return std::char_traits< char >::to_char_type(buf.sbumpc()) == exp;
+    }
+
+    template< class T >
+    bool readInteger(T& dest)
+    {
+      if (!skipSpaces())
+      {
+        return false;
+      }
+      using Limits = std::numeric_limits< T >;
+      bool isNegative = false;
+      int c = peek();
+      if (c == '+' || c == '-')
+      {
+        isNegative = c == '-';
+        c = buf.snextc();
+      }
+      unsigned long long limit = Limits::max();
+      limit += (Limits::is_signed && isNegative) ? 1 : 0;
+      unsigned long long value = 0;
+      bool hasDigits = false;
+      bool isOverflow = false;
+      for (; c >= '0' && c <= '9'; c = buf.snextc())
+      {
+        unsigned long long digit = static_cast< unsigned long long >(c - '0');
+        isOverflow = isOverflow || value > (limit - digit) / 10;
+        value = isOverflow ? value : value * 10 + digit;
+        hasDigits = true;
+      }
+      isEof = c == std::char_traits< char >::eof();
+      if (!hasDigits)
+      {
+        dest = 0;
+        return false;
+      }
+      if (isOverflow)
+      {
+        dest = (Limits::is_signed && isNegative) ? Limits::min() : Limits::max();
+        return false;
+      }
+      dest = static_cast< T >(isNegative ? 0 - value : value);
+      return true;
+    }
+  };
+}
 
 namespace aleksandrov
 {
@@ -36,11 +117,20 @@ namespace aleksandrov
     {
       return in;
     }
-    in >> DelimeterI{ '(' } >> DelimeterI{ ':' };
-    in >> DelimeterI{ 'N' } >> LongLongI{ dest.ref.first };
-    in >> DelimeterI{ ':' };
-    in >> DelimeterI{ 'D' } >> UnsignedLongLongI{ dest.ref.second };
-    in >> DelimeterI{ ':' } >> DelimeterI{ ')' };
+    ByteCursor cursor{ *in.rdbuf() };
+    bool isRead = cursor.expect('(') && cursor.expect(':');
+    isRead = isRead && cursor.expect('N') && cursor.readInteger(dest.ref.first);
+    isRead = isRead && cursor.expect(':');
+    isRead = isRead && cursor.expect('D') && cursor.readInteger(dest.ref.second);
+    isRead = isRead && cursor.expect(':') && cursor.expect(')');
+    if (cursor.isEof)
+    {
+      in.setstate(std::ios::eofbit);
+    }
+    if (!isRead)
+    {
+      in.setstate(std::ios::failbit);
+    }
     return in;
   }
 
@@ -2,15 +2,31 @@
 #include <iterator>
 #include <vector>
 #include <algorithm>
+#include <cstring>
 #include "data-struct.hpp"
 #include "stream-guard.hpp"
 #include "input-struct.hpp"
 #include "output-struct.hpp"
+#include "sort-key.hpp"
+#include "benchmark.hpp"
 
-int main()
+int main(int argc, char* argv[])
 {
   using namespace aleksandrov;
 
+  bool isDecorated = argc == 2 && std::strcmp(argv[1], "--decorated") == 0;
+  bool isBenchmark = argc == 2 && std::strcmp(argv[1], "--bench") == 0;
+  if (argc != 1 && !isDecorated && !isBenchmark)
+  {
+    std::cerr << "<INVALID PARAMETERS>\n";
+    return 1;
+  }
+  if (isBenchmark)
+  {
+    benchmarkRationals(std::cout);
+    return 0;
+  }
+
   std::vector< DataStruct > data;
 
   using InputDataIt = std::istream_iterator< DataStruct >;
@@ -25,7 +41,14 @@ int main()
       std::cin.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
     }
   }
-  std::sort(data.begin(), data.end());
+  if (isDecorated)
+  {
+    sortDecorated(data);
+  }
+  else
+  {
+    std::sort(data.begin(), data.end());
+  }
   std::copy(std::begin(data), std::end(data), OutputDataIt(std::cout, "\n"));
 }
 
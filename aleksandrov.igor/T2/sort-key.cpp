@@ -0,0 +1,117 @@
+#include "sort-key.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+  struct Product
+  {
+    unsigned long long high;
+    unsigned long long low;
+  };
+
+  Product multiply(unsigned long long lhs, unsigned long long rhs)
+  {
+    const unsigned long long mask = 0xFFFFFFFFull;
+    unsigned long long lhsLow = lhs & mask;
+    unsigned long long lhsHigh = lhs >> 32;
+    unsigned long long rhsLow = rhs & mask;
+    unsigned long long rhsHigh = rhs >> 32;
+    unsigned long long lowLow = lhsLow * rhsLow;
+    unsigned long long lowHigh = lhsLow * rhsHigh;
+    unsigned long long highLow = lhsHigh * rhsLow;
+    unsigned long long middle = (lowLow >> 32) + (lowHigh & mask) + (highLow & mask);
+    unsigned long long high = lhsHigh * rhsHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+    return { high, (middle << 32) | (lowLow & mask) };
+  }
+
+  int compareFractions(const aleksandrov::SortKey& lhs, const aleksandrov::SortKey& rhs)
+  {
+    Product left = multiply(lhs.remainder, rhs.denominator);
+    Product right = multiply(rhs.remainder, lhs.denominator);
+    if (left.high != right.high)
+    {
+      return left.high < right.high ? -1 : 1;
+    }
+    if (left.low != right.low)
+    {
+      return left.low < right.low ? -1 : 1;
+    }
+    return 0;
+  }
+}
+
+namespace aleksandrov
+{
+  SortKey makeSortKey(const DataStruct& data, size_t index)
+  {
+    SortKey key{ data.key1, 0, 0, 0, 1, data.key3.size(), index };
+    long long numerator = data.key2.first;
+    unsigned long long denominator = data.key2.second;
+    if (denominator == 0)
+    {
+      key.rationalRank = numerator < 0 ? -1 : 1;
+      return key;
+    }
+    key.denominator = denominator;
+    if (numerator >= 0)
+    {
+      key.quotient = static_cast< long long >(static_cast< unsigned long long >(numerator) / denominator);
+      key.remainder = static_cast< unsigned long long >(numerator) % denominator;
+      return key;
+    }
+    unsigned long long magnitude = 0ull - static_cast< unsigned long long >(numerator);
+    unsigned long long quotient = magnitude / denominator;
+    unsigned long long remainder = magnitude % denominator;
+    if (remainder == 0)
+    {
+      key.quotient = -static_cast< long long >(quotient - 1) - 1;
+    }
+    else
+    {
+      key.quotient = -static_cast< long long >(quotient) - 1;
+      key.remainder = denominator - remainder;
+    }
+    return key;
+  }
+
+  bool operator<(const SortKey& lhs, const SortKey& rhs)
+  {
+    if (lhs.key1 != rhs.key1)
+    {
+      return lhs.key1 < rhs.key1;
+    }
+    if (lhs.rationalRank != rhs.rationalRank)
+    {
+      return lhs.rationalRank < rhs.rationalRank;
+    }
+    if (lhs.quotient != rhs.quotient)
+    {
+      return lhs.quotient < rhs.quotient;
+    }
+    int fractionOrder = compareFractions(lhs, rhs);
+    if (fractionOrder != 0)
+    {
+      return fractionOrder < 0;
+    }
+    return lhs.key3Size < rhs.key3Size;
+  }
+
+  void sortDecorated(std::vector< DataStruct >& data)
+  {
+    std::vector< SortKey > keys;
+    keys.reserve(data.size());
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+      keys.push_back(makeSortKey(data[i], i));
+    }
+    std::sort(keys.begin(), keys.end());
+    std::vector< DataStruct > sorted;
+    sorted.reserve(data.size());
+    for (const SortKey& key: keys)
+    {
+      sorted.push_back(std::move(data[key.index]));
+    }
+    data.swap(sorted);
+  }
+}
@@ -0,0 +1,25 @@
+#ifndef SORT_KEY_HPP
+#define SORT_KEY_HPP
+
+#include <vector>
+#include "data-struct.hpp"
+
+namespace aleksandrov
+{
+  struct SortKey
+  {
+    double key1;
+    int rationalRank;
+    long long quotient;
+    unsigned long long remainder;
+    unsigned long long denominator;
+    size_t key3Size;
+    size_t index;
+  };
+
+  SortKey makeSortKey(const DataStruct&, size_t);
+  bool operator<(const SortKey&, const SortKey&);
+  void sortDecorated(std::vector< DataStruct >&);
+}
+
+#endif
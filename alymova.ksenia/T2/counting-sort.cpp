@@ -0,0 +1,119 @@
+#include "counting-sort.hpp"
+#include <algorithm>
+#include <climits>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+  const size_t KEY2_COUNT = UCHAR_MAX + 1;
+  const size_t MIN_GROUP_SIZE = 64;
+  const size_t MAX_COUNTED_KEY3_SIZE = 1 << 16;
+
+  struct CountingKeys
+  {
+    size_t index;
+    size_t group;
+    size_t key2;
+    size_t key3Size;
+  };
+
+  template< class Key >
+  void countingPass(std::vector< CountingKeys >& keys, std::vector< CountingKeys >& buffer, size_t bucketCount, Key key)
+  {
+    std::vector< size_t > offsets(bucketCount + 1, 0);
+    for (const CountingKeys& record: keys)
+    {
+      offsets[key(record) + 1]++;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    for (const CountingKeys& record: keys)
+    {
+      buffer[offsets[key(record)]++] = record;
+    }
+    keys.swap(buffer);
+  }
+
+  bool rankKey1Groups(std::vector< alymova::DataStruct >& data, std::vector< size_t >& groups, size_t& groupCount)
+  {
+    const size_t maxGroups = data.size() / MIN_GROUP_SIZE + 1;
+    std::unordered_map< unsigned long long int, size_t > ids;
+    ids.reserve(maxGroups);
+    std::vector< size_t > firsts;
+    groups.resize(data.size());
+    for (size_t i = 0; i < data.size(); i++)
+    {
+      auto found = ids.find(data[i].key1);
+      if (found == ids.end())
+      {
+        if (firsts.size() == maxGroups)
+        {
+          return false;
+        }
+        found = ids.emplace(data[i].key1, firsts.size()).first;
+        firsts.push_back(i);
+      }
+      groups[i] = found->second;
+    }
+    std::vector< size_t > order(firsts.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&data, &firsts](size_t lhs, size_t rhs)
+    {
+      return data[firsts[lhs]] < data[firsts[rhs]];
+    });
+    std::vector< size_t > ranks(order.size());
+    for (size_t i = 0; i < order.size(); i++)
+    {
+      ranks[order[i]] = i;
+    }
+    for (size_t& group: groups)
+    {
+      group = ranks[group];
+    }
+    groupCount = order.size();
+    return true;
+  }
+}
+
+void alymova::countingSort(std::vector< DataStruct >& data)
+{
+  size_t maxKey3Size = 0;
+  for (const DataStruct& record: data)
+  {
+    maxKey3Size = std::max(maxKey3Size, record.key3.size());
+  }
+  std::vector< size_t > groups;
+  size_t groupCount = 0;
+  if (maxKey3Size > MAX_COUNTED_KEY3_SIZE || !rankKey1Groups(data, groups, groupCount))
+  {
+    std::stable_sort(data.begin(), data.end());
+    return;
+  }
+  std::vector< CountingKeys > keys;
+  keys.reserve(data.size());
+  for (size_t i = 0; i < data.size(); i++)
+  {
+    keys.push_back({i, groups[i], static_cast< size_t >(data[i].key2 - CHAR_MIN), data[i].key3.size()});
+  }
+  std::vector< CountingKeys > buffer(keys.size());
+  countingPass(keys, buffer, maxKey3Size + 1, [](const CountingKeys& record)
+  {
+    return record.key3Size;
+  });
+  countingPass(keys, buffer, KEY2_COUNT, [](const CountingKeys& record)
+  {
+    return record.key2;
+  });
+  countingPass(keys, buffer, groupCount, [](const CountingKeys& record)
+  {
+    return record.group;
+  });
+  std::vector< DataStruct > sorted;
+  sorted.reserve(data.size());
+  for (const CountingKeys& record: keys)
+  {
+    sorted.push_back(std::move(data[record.index]));
+  }
+  data.swap(sorted);
+}
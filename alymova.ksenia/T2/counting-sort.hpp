@@ -0,0 +1,10 @@
+#ifndef COUNTING_SORT_HPP
+#define COUNTING_SORT_HPP
+#include <vector>
+#include "structs.hpp"
+
+namespace alymova
+{
+  void countingSort(std::vector< DataStruct >& data);
+}
+#endif
@@ -3,13 +3,22 @@
 #include <vector>
 #include <iterator>
 #include <algorithm>
+#include <cstring>
 #include "structs.hpp"
+#include "counting-sort.hpp"
 #include <stream-guard.hpp>
 
-int main()
+int main(int argc, char* argv[])
 {
   using namespace alymova;
 
+  bool isCounting = argc == 2 && std::strcmp(argv[1], "--counting") == 0;
+  if (argc != 1 && !isCounting)
+  {
+    std::cerr << "<INVALID PARAMETERS>\n";
+    return 1;
+  }
+
   std::vector< DataStruct > data;
   while (!std::cin.eof())
   {
@@ -23,7 +32,14 @@ int main()
       std::back_inserter(data)
     );
   }
-  std::sort(data.begin(), data.end());
+  if (isCounting)
+  {
+    countingSort(data);
+  }
+  else
+  {
+    std::sort(data.begin(), data.end());
+  }
   std::copy(
     data.begin(),
     data.end(),
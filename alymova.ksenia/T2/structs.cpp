@@ -1,8 +1,35 @@
 #include "structs.hpp"
+#include <cctype>
 #include <iostream>
 #include <stream-guard.hpp>
 #include <delimiter-io.hpp>
 
+namespace
+{
+  using Traits = std::char_traits< char >;
+
+  const size_t CHR_LIT_SIZE = 3;
+
+  bool readChar(std::streambuf& buf, bool isSkipws, char& c)
+  {
+    if (isSkipws)
+    {
+      int next = buf.sgetc();
+      while (!Traits::eq_int_type(next, Traits::eof()) && std::isspace(next))
+      {
+        next = buf.snextc();
+      }
+    }
+    int got = buf.sbumpc();
+    if (Traits::eq_int_type(got, Traits::eof()))
+    {
+      return false;
+    }
+    c = Traits::to_char_type(got);
+    return true;
+  }
+}
+
 std::istream& alymova::operator>>(std::istream& in, LabelIO&& object)
 {
   std::istream::sentry sentry(in);
@@ -42,7 +69,24 @@ std::istream& alymova::operator>>(std::istream& in, ChrLitIO&& object)
   {
     return in;
   }
-  return in >> DelimiterIO{'\''} >> object.c >> DelimiterIO{'\''};
+  std::streambuf& buf = *in.rdbuf();
+  bool isSkipws = (in.flags() & std::ios::skipws) != 0;
+  char literal[CHR_LIT_SIZE] = {};
+  for (size_t i = 0; i < CHR_LIT_SIZE; i++)
+  {
+    if (!readChar(buf, isSkipws, literal[i]))
+    {
+      in.setstate(std::ios::eofbit | std::ios::failbit);
+      return in;
+    }
+    if (i != 1 && literal[i] != '\'')
+    {
+      in.setstate(std::ios::failbit);
+      return in;
+    }
+  }
+  object.c = literal[1];
+  return in;
 }
 
 std::istream& alymova::operator>>(std::istream& in, StringIO&& object)
@@ -127,14 +171,15 @@ std::ostream& alymova::operator<<(std::ostream& out, const DataStruct& object)
   out << ":key1 ";
   out << '0' << std::oct << object.key1;
   out << ":key2 ";
-  out << "'" << object.key2 << "'";
+  const char literal[CHR_LIT_SIZE] = {'\'', object.key2, '\''};
+  out.write(literal, CHR_LIT_SIZE);
   out << ":key3 ";
   out << "\"" << object.key3 << "\"";
   out << ":)";
   return out;
 }
 
-bool alymova::DataStruct::operator<(const DataStruct& other)
+bool alymova::DataStruct::operator<(const DataStruct& other) const
 {
   if (key1 != other.key1)
   {
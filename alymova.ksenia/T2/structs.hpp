@@ -27,7 +27,7 @@ namespace alymova
     char key2;
     std::string key3;
 
-    bool operator<(const DataStruct& other);
+    bool operator<(const DataStruct& other) const;
   };
   std::istream& operator>>(std::istream& in, LabelIO&& object);
   std::istream& operator>>(std::istream& in, UllOctIO&& object);
@@ -1,22 +1,173 @@
 #include "dataStruct.hpp"
 
+#include <cctype>
 #include <cmath>
-#include <iomanip>
+#include <cstdio>
+#include <cstdlib>
 
-duhanina::Iofmtguard::Iofmtguard(std::basic_ios< char >& s):
-  s_(s),
-  width_(s.width()),
-  fill_(s.fill()),
-  precision_(s.precision()),
-  fmt_(s.flags())
-{}
+#include "magnitudeSort.hpp"
 
-duhanina::Iofmtguard::~Iofmtguard()
+namespace
 {
-  s_.width(width_);
-  s_.fill(fill_);
-  s_.precision(precision_);
-  s_.flags(fmt_);
+  using Traits = std::char_traits< char >;
+
+  const double EXACT_INTEGER_LIMIT = 9007199254740992.0;
+  const int MANTISSA_BITS = 53;
+  const int MAX_FRACTION_SHIFT = 60;
+  const size_t FIXED_BUFFER_SIZE = 328;
+
+  class ComplexCursor
+  {
+  public:
+    explicit ComplexCursor(std::streambuf& buf):
+      buf_(buf),
+      isEof_(false)
+    {}
+
+    bool isEof() const
+    {
+      return isEof_;
+    }
+
+    bool expect(char exp)
+    {
+      if (!skipSpaces())
+      {
+        return false;
+      }
+      return Traits::to_char_type(buf_.sbumpc()) == exp;
+    }
+
+    bool readDouble(double& dest)
+    {
+      if (!skipSpaces())
+      {
+        return false;
+      }
+      digits_.clear();
+      int c = buf_.sgetc();
+      if (c == '+' || c == '-')
+      {
+        digits_ += Traits::to_char_type(c);
+        c = next();
+      }
+      bool hasMantissa = false;
+      bool hasDot = false;
+      bool hasExponent = false;
+      while (!isEof_)
+      {
+        if (c >= '0' && c <= '9')
+        {
+          digits_ += Traits::to_char_type(c);
+          hasMantissa = true;
+        }
+        else if (c == '.' && !hasDot && !hasExponent)
+        {
+          digits_ += '.';
+          hasDot = true;
+        }
+        else if ((c == 'e' || c == 'E') && !hasExponent && hasMantissa)
+        {
+          digits_ += 'e';
+          hasExponent = true;
+          c = next();
+          if (isEof_ || (c != '+' && c != '-'))
+          {
+            continue;
+          }
+          digits_ += Traits::to_char_type(c);
+        }
+        else
+        {
+          break;
+        }
+        c = next();
+      }
+      const char* first = digits_.c_str();
+      char* last = nullptr;
+      dest = std::strtod(first, &last);
+      return last != first && *last == '\0' && dest != HUGE_VAL && dest != -HUGE_VAL;
+    }
+
+  private:
+    std::streambuf& buf_;
+    bool isEof_;
+    std::string digits_;
+
+    int next()
+    {
+      int c = buf_.snextc();
+      isEof_ = Traits::eq_int_type(c, Traits::eof());
+      return c;
+    }
+
+    bool skipSpaces()
+    {
+      int c = buf_.sgetc();
+      isEof_ = Traits::eq_int_type(c, Traits::eof());
+      while (!isEof_ && std::isspace(c))
+      {
+        c = next();
+      }
+      return !isEof_;
+    }
+  };
+
+  char* formatFixed(double value, char* dest)
+  {
+    double magnitude = std::fabs(value);
+    if (!(magnitude < EXACT_INTEGER_LIMIT))
+    {
+      return dest + std::snprintf(dest, FIXED_BUFFER_SIZE, "%.1f", value);
+    }
+    if (std::signbit(value))
+    {
+      *dest++ = '-';
+    }
+    int exponent = 0;
+    double fraction = std::frexp(magnitude, &exponent);
+    unsigned long long mantissa = static_cast< unsigned long long >(std::ldexp(fraction, MANTISSA_BITS));
+    int shift = MANTISSA_BITS - exponent;
+    unsigned long long integral = 0;
+    unsigned long long tenth = 0;
+    if (shift == 0)
+    {
+      integral = mantissa;
+    }
+    else if (shift <= MAX_FRACTION_SHIFT)
+    {
+      unsigned long long mask = (1ull << shift) - 1;
+      unsigned long long scaled = (mantissa & mask) * 10;
+      unsigned long long rest = scaled & mask;
+      unsigned long long half = 1ull << (shift - 1);
+      integral = mantissa >> shift;
+      tenth = scaled >> shift;
+      if (rest > half || (rest == half && tenth % 2 == 1))
+      {
+        ++tenth;
+      }
+      if (tenth == 10)
+      {
+        tenth = 0;
+        ++integral;
+      }
+    }
+    char reversed[20];
+    size_t count = 0;
+    do
+    {
+      reversed[count++] = static_cast< char >('0' + integral % 10);
+      integral /= 10;
+    }
+    while (integral != 0);
+    while (count != 0)
+    {
+      *dest++ = reversed[--count];
+    }
+    *dest++ = '.';
+    *dest++ = static_cast< char >('0' + tenth);
+    return dest;
+  }
 }
 
 std::istream& duhanina::operator>>(std::istream& in, DelimiterIO&& dest)
@@ -55,13 +206,18 @@ std::istream& duhanina::operator>>(std::istream& in, ComplexIO&& dest)
   }
   double real = 0.0;
   double imag = 0.0;
-  in >> DelimiterIO{ '#' };
-  in >> DelimiterIO{ 'c' };
-  in >> DelimiterIO{ '(' };
-  in >> real;
-  in >> imag;
-  in >> DelimiterIO{ ')' };
-  if (in)
+  ComplexCursor cursor(*in.rdbuf());
+  bool isRead = cursor.expect('#') && cursor.expect('c') && cursor.expect('(');
+  isRead = isRead && cursor.readDouble(real) && cursor.readDouble(imag) && cursor.expect(')');
+  if (cursor.isEof())
+  {
+    in.setstate(std::ios::eofbit);
+  }
+  if (!isRead)
+  {
+    in.setstate(std::ios::failbit);
+  }
+  else
   {
     dest.ref = std::complex< double >(real, imag);
   }
@@ -133,6 +289,7 @@ std::istream& duhanina::operator>>(std::istream& in, DataStruct& dest)
   }
   if (in && k1 && k2 && k3)
   {
+    storeMagnitude(temp);
     dest = temp;
   }
   else
@@ -149,10 +306,14 @@ std::ostream& duhanina::operator<<(std::ostream& out, const DataStruct& src)
   {
     return out;
   }
-  Iofmtguard guard(out);
+  char key2[2 * FIXED_BUFFER_SIZE + 8] = "key2 #c(";
+  char* last = formatFixed(src.key2.real(), key2 + 8);
+  *last++ = ' ';
+  last = formatFixed(src.key2.imag(), last);
+  *last++ = ')';
+  *last++ = ':';
   out << "(:key1 " << src.key1 << "ll:";
-  out << "key2 #c(" << std::fixed << std::setprecision(1) << src.key2.real();
-  out << " " << src.key2.imag() << "):";
+  out.write(key2, last - key2);
   out << "key3 \"" << src.key3 << "\":)";
   return out;
 }
@@ -12,6 +12,9 @@ namespace duhanina
     long long key1;
     std::complex< double > key2;
     std::string key3;
+    double magnitude = 0.0;
+    double squaredMagnitude = 0.0;
+    bool isSquaredExact = false;
 
     bool operator<(const DataStruct& other) const;
   };
@@ -41,20 +44,6 @@ namespace duhanina
     std::string exp;
   };
 
-  class Iofmtguard
-  {
-  public:
-    explicit Iofmtguard(std::basic_ios< char >& s);
-    ~Iofmtguard();
-
-  private:
-    std::basic_ios< char >& s_;
-    std::streamsize width_;
-    char fill_;
-    std::streamsize precision_;
-    std::basic_ios< char >::fmtflags fmt_;
-  };
-
   std::istream& operator>>(std::istream& in, DelimiterIO&& dest);
   std::istream& operator>>(std::istream& in, ComplexIO&& dest);
   std::istream& operator>>(std::istream& in, LongLongIO&& dest);
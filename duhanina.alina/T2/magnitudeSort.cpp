@@ -0,0 +1,78 @@
+#include "magnitudeSort.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace
+{
+  const double MIN_EXACT_COMPONENT = std::ldexp(1.0, -400);
+
+  bool isExactSquare(double value, double& square)
+  {
+    square = value * value;
+    bool isRepresentable = value == 0.0 || std::fabs(value) >= MIN_EXACT_COMPONENT;
+    return isRepresentable && std::fma(value, value, -square) == 0.0;
+  }
+}
+
+bool duhanina::MagnitudeKey::operator<(const MagnitudeKey& other) const
+{
+  if (key1 != other.key1)
+  {
+    return key1 < other.key1;
+  }
+  if (magnitude != other.magnitude)
+  {
+    return magnitude < other.magnitude;
+  }
+  if (key3Size != other.key3Size)
+  {
+    return key3Size < other.key3Size;
+  }
+  return index < other.index;
+}
+
+bool duhanina::isExactNorm(const std::complex< double >& value, double& norm)
+{
+  double realSquare = 0.0;
+  double imagSquare = 0.0;
+  bool isExact = isExactSquare(value.real(), realSquare) && isExactSquare(value.imag(), imagSquare);
+  norm = realSquare + imagSquare;
+  double rounded = norm - realSquare;
+  double error = (realSquare - (norm - rounded)) + (imagSquare - rounded);
+  return isExact && std::isfinite(norm) && error == 0.0;
+}
+
+void duhanina::storeMagnitude(DataStruct& record)
+{
+  record.magnitude = std::abs(record.key2);
+  record.isSquaredExact = isExactNorm(record.key2, record.squaredMagnitude);
+}
+
+void duhanina::sortByMagnitude(std::vector< DataStruct >& data, bool useSquared)
+{
+  std::vector< MagnitudeKey > keys;
+  keys.reserve(data.size());
+  bool isSquaredExact = useSquared;
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    keys.push_back({ data[i].key1, data[i].magnitude, data[i].key3.size(), i });
+    isSquaredExact = isSquaredExact && data[i].isSquaredExact;
+  }
+  if (isSquaredExact)
+  {
+    for (MagnitudeKey& key: keys)
+    {
+      key.magnitude = data[key.index].squaredMagnitude;
+    }
+  }
+  std::sort(keys.begin(), keys.end());
+  std::vector< DataStruct > sorted;
+  sorted.reserve(data.size());
+  for (const MagnitudeKey& key: keys)
+  {
+    sorted.push_back(std::move(data[key.index]));
+  }
+  data.swap(sorted);
+}
@@ -0,0 +1,24 @@
+#ifndef MAGNITUDE_SORT_HPP
+#define MAGNITUDE_SORT_HPP
+
+#include <vector>
+#include "dataStruct.hpp"
+
+namespace duhanina
+{
+  struct MagnitudeKey
+  {
+    long long key1;
+    double magnitude;
+    size_t key3Size;
+    size_t index;
+
+    bool operator<(const MagnitudeKey& other) const;
+  };
+
+  bool isExactNorm(const std::complex< double >& value, double& norm);
+  void storeMagnitude(DataStruct& record);
+  void sortByMagnitude(std::vector< DataStruct >& data, bool useSquared);
+}
+
+#endif
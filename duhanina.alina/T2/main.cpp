@@ -3,11 +3,20 @@
 #include <iterator>
 #include <iostream>
 #include <algorithm>
+#include <cstring>
 #include "dataStruct.hpp"
+#include "magnitudeSort.hpp"
 
-int main()
+int main(int argc, char* argv[])
 {
   using namespace duhanina;
+  bool useMagnitude = argc == 2 && std::strcmp(argv[1], "--magnitude") == 0;
+  bool useSquared = argc == 2 && std::strcmp(argv[1], "--squared-magnitude") == 0;
+  if (argc != 1 && !useMagnitude && !useSquared)
+  {
+    std::cerr << "<INVALID PARAMETERS>\n";
+    return 1;
+  }
   using istIter = std::istream_iterator< DataStruct >;
   using ostIter = std::ostream_iterator< DataStruct >;
   std::vector< DataStruct > data;
@@ -20,7 +29,14 @@ int main()
       std::cin.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
     }
   }
-  std::sort(data.begin(), data.end());
+  if (useMagnitude || useSquared)
+  {
+    sortByMagnitude(data, useSquared);
+  }
+  else
+  {
+    std::sort(data.begin(), data.end());
+  }
   std::copy(data.begin(), data.end(), ostIter(std::cout, "\n"));
   return 0;
 }
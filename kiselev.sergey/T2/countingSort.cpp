@@ -0,0 +1,92 @@
+#include "countingSort.hpp"
+#include <algorithm>
+#include <climits>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+  const size_t CHAR_COUNT = UCHAR_MAX + 1;
+  const size_t MAX_LENGTH = 1 << 16;
+
+  struct Item
+  {
+    size_t index;
+    size_t bucket;
+    size_t length;
+  };
+
+  void countBy(std::vector< Item >& items, std::vector< Item >& temp, size_t count, size_t Item::*field)
+  {
+    std::vector< size_t > starts(count + 1, 0);
+    for (const Item& item: items)
+    {
+      starts[item.*field + 1]++;
+    }
+    for (size_t i = 1; i < starts.size(); i++)
+    {
+      starts[i] += starts[i - 1];
+    }
+    for (const Item& item: items)
+    {
+      temp[starts[item.*field]++] = item;
+    }
+    items.swap(temp);
+  }
+}
+
+void kiselev::countingSort(std::vector< DataStruct >& data)
+{
+  const size_t maxKeys = data.size() / CHAR_COUNT + 1;
+  std::unordered_map< unsigned long long, size_t > keys;
+  keys.reserve(maxKeys);
+  std::vector< size_t > firsts;
+  std::vector< Item > items(data.size());
+  for (size_t i = 0; i < data.size(); i++)
+  {
+    auto it = keys.find(data[i].key1);
+    bool isNew = it == keys.end();
+    if (data[i].key3.size() > MAX_LENGTH || (isNew && firsts.size() == maxKeys))
+    {
+      std::stable_sort(data.begin(), data.end(), compare);
+      return;
+    }
+    if (isNew)
+    {
+      it = keys.emplace(data[i].key1, firsts.size()).first;
+      firsts.push_back(i);
+    }
+    items[i] = { i, it->second, data[i].key3.size() };
+  }
+  std::vector< size_t > order(firsts.size());
+  for (size_t i = 0; i < order.size(); i++)
+  {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&data, &firsts](size_t lhs, size_t rhs)
+  {
+    return compare(data[firsts[lhs]], data[firsts[rhs]]);
+  });
+  std::vector< size_t > ranks(order.size());
+  for (size_t i = 0; i < order.size(); i++)
+  {
+    ranks[order[i]] = i;
+  }
+  size_t maxLength = 0;
+  for (Item& item: items)
+  {
+    char key2 = data[item.index].key2;
+    item.bucket = ranks[item.bucket] * CHAR_COUNT + static_cast< size_t >(key2 - CHAR_MIN);
+    maxLength = std::max(maxLength, item.length);
+  }
+  std::vector< Item > temp(items.size());
+  countBy(items, temp, maxLength + 1, &Item::length);
+  countBy(items, temp, order.size() * CHAR_COUNT, &Item::bucket);
+  std::vector< DataStruct > sorted;
+  sorted.reserve(data.size());
+  for (const Item& item: items)
+  {
+    sorted.push_back(std::move(data[item.index]));
+  }
+  data.swap(sorted);
+}
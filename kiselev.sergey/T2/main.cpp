@@ -3,13 +3,21 @@
 #include <limits>
 #include <iterator>
 #include <iostream>
+#include <cstring>
 #include "data.hpp"
-int main()
+#include "countingSort.hpp"
+int main(int argc, char* argv[])
 {
   using dataSt = kiselev::DataStruct;
   using istreamIt = std::istream_iterator< dataSt >;
   using ostreamIt = std::ostream_iterator< dataSt >;
 
+  if (argc > 2 || (argc == 2 && std::strcmp(argv[1], "--counting") != 0))
+  {
+    std::cerr << "Usage: " << argv[0] << " [--counting]\n";
+    return 1;
+  }
+
   std::vector< dataSt > data;
   while(!std::cin.eof())
   {
@@ -22,7 +30,14 @@ int main()
     }
   }
 
-  std::sort(data.begin(), data.end(), kiselev::compare);
+  if (argc == 2)
+  {
+    kiselev::countingSort(data);
+  }
+  else
+  {
+    std::sort(data.begin(), data.end(), kiselev::compare);
+  }
   std::copy(std::begin(data),std::end(data), ostreamIt(std::cout, "\n"));
   return 0;
 }
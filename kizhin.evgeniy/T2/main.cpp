@@ -1,11 +1,41 @@
 #include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <stdexcept>
+#include <thread>
 #include <vector>
 #include "data-struct.hpp"
+#include "parallel-sort.hpp"
 
-int main()
+namespace kizhin {
+  std::size_t parseThreadCount(int, char**);
+}
+
+std::size_t kizhin::parseThreadCount(const int argc, char** const argv)
+{
+  if (argc == 1) {
+    return 1;
+  }
+  if (argc != 3 || std::strcmp(argv[1], "--threads") != 0) {
+    throw std::invalid_argument("Usage: lab [--threads N]");
+  }
+  char* last = nullptr;
+  const auto count = std::strtoul(argv[2], &last, 10);
+  if (!std::isdigit(static_cast< unsigned char >(*argv[2])) || *last != '\0') {
+    throw std::invalid_argument("Invalid thread count");
+  }
+  if (count == 0) {
+    return std::max(1u, std::thread::hardware_concurrency());
+  }
+  return count;
+}
+
+int main(int argc, char** argv)
 {
   using namespace kizhin;
   using DSContainer = std::vector< DataStruct >;
@@ -13,13 +43,14 @@ int main()
   using OutIt = std::ostream_iterator< DataStruct >;
 
   try {
+    const auto threadCount = parseThreadCount(argc, argv);
     DSContainer vals(InputIt(std::cin), InputIt{});
     constexpr auto MaxSize = std::numeric_limits< std::streamsize >::max();
     while (!std::cin.eof()) {
       std::cin.clear();
       vals.insert(vals.end(), InputIt(std::cin.ignore(MaxSize, '\n')), InputIt{});
     }
-    std::sort(vals.begin(), vals.end());
+    parallelSort(vals.begin(), vals.end(), std::less< DataStruct >{}, threadCount);
     std::copy(vals.begin(), vals.end(), OutIt(std::cout, "\n"));
   } catch (const std::exception& e) {
     std::cerr << "Error: " << e.what() << '\n';
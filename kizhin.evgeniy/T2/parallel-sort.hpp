@@ -0,0 +1,70 @@
+#ifndef SPBSPU_LABS_2025_TP_A_KIZHIN_EVGENIY_T2_PARALLEL_SORT_HPP
+#define SPBSPU_LABS_2025_TP_A_KIZHIN_EVGENIY_T2_PARALLEL_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace kizhin {
+  template< typename RandomIt, typename Compare >
+  void parallelSort(RandomIt, RandomIt, Compare, std::size_t);
+
+  namespace detail {
+    constexpr std::size_t minChunkSize = 1 << 12;
+
+    template< typename Task >
+    void runTasks(std::size_t, Task);
+  }
+}
+
+template< typename Task >
+void kizhin::detail::runTasks(const std::size_t count, Task task)
+{
+  std::vector< std::future< void > > pending;
+  pending.reserve(count);
+  for (std::size_t i = 1; i < count; ++i) {
+    pending.push_back(std::async(std::launch::async, task, i));
+  }
+  task(0);
+  for (auto& result: pending) {
+    result.get();
+  }
+}
+
+template< typename RandomIt, typename Compare >
+void kizhin::parallelSort(const RandomIt first, const RandomIt last, const Compare comp,
+    const std::size_t threadCount)
+{
+  const auto size = static_cast< std::size_t >(std::distance(first, last));
+  const std::size_t coreCount = std::max(1u, std::thread::hardware_concurrency());
+  const auto chunkCount = std::min({ threadCount, coreCount, size / detail::minChunkSize });
+  if (chunkCount < 2) {
+    std::sort(first, last, comp);
+    return;
+  }
+  std::vector< RandomIt > bounds;
+  bounds.reserve(chunkCount + 1);
+  for (std::size_t i = 0; i != chunkCount; ++i) {
+    bounds.push_back(first + size * i / chunkCount);
+  }
+  bounds.push_back(last);
+  detail::runTasks(chunkCount, [&bounds, comp](const std::size_t i)
+  {
+    std::sort(bounds[i], bounds[i + 1], comp);
+  });
+  for (std::size_t width = 1; width < chunkCount; width *= 2) {
+    const auto mergeCount = (chunkCount + 2 * width - 1) / (2 * width);
+    detail::runTasks(mergeCount, [&bounds, comp, width, chunkCount](const std::size_t i)
+    {
+      const auto begin = 2 * width * i;
+      const auto middle = std::min(begin + width, chunkCount);
+      const auto end = std::min(begin + 2 * width, chunkCount);
+      std::inplace_merge(bounds[begin], bounds[middle], bounds[end], comp);
+    });
+  }
+}
+
+#endif
@@ -0,0 +1,99 @@
+#include "binUllDecoder.hpp"
+
+namespace
+{
+  const unsigned long long ASCII_ZEROS = 0x3030303030303030ull;
+  const unsigned long long DIGIT_MASK = 0xFEFEFEFEFEFEFEFEull;
+  const unsigned long long LOW_BITS = 0x0101010101010101ull;
+  const unsigned long long GATHER_BITS = 0x8040201008040201ull;
+  const int WORD_BYTES = 8;
+  const int WORD_BITS = 64;
+
+  unsigned long long loadWord(const char* pos) noexcept
+  {
+    unsigned long long word = 0;
+    for (int i = 0; i < WORD_BYTES; ++i)
+    {
+      word |= static_cast< unsigned long long >(static_cast< unsigned char >(pos[i])) << (i * WORD_BYTES);
+    }
+    return word;
+  }
+
+  bool isSpace(char c) noexcept
+  {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+  }
+}
+
+kostyukov::BinUllDecoder::BinUllDecoder() noexcept:
+  value_(0),
+  isLeading_(true),
+  hasSign_(false),
+  isNegative_(false),
+  hasDigits_(false),
+  isValid_(true)
+{}
+
+void kostyukov::BinUllDecoder::feed(const char* begin, const char* end) noexcept
+{
+  while (isLeading_ && begin != end)
+  {
+    if (!hasSign_ && isSpace(*begin))
+    {
+      ++begin;
+    }
+    else if (!hasSign_ && (*begin == '+' || *begin == '-'))
+    {
+      hasSign_ = true;
+      isNegative_ = *begin == '-';
+      ++begin;
+    }
+    else
+    {
+      isLeading_ = false;
+    }
+  }
+  feedDigits(begin, end);
+}
+
+void kostyukov::BinUllDecoder::feedDigits(const char* begin, const char* end) noexcept
+{
+  for (; isValid_ && end - begin >= WORD_BYTES; begin += WORD_BYTES)
+  {
+    unsigned long long word = loadWord(begin);
+    if ((word & DIGIT_MASK) != ASCII_ZEROS || (value_ >> (WORD_BITS - WORD_BYTES)) != 0)
+    {
+      isValid_ = false;
+      return;
+    }
+    value_ = (value_ << WORD_BYTES) | (((word & LOW_BITS) * GATHER_BITS) >> (WORD_BITS - WORD_BYTES));
+    hasDigits_ = true;
+  }
+  for (; isValid_ && begin != end; ++begin)
+  {
+    if ((*begin != '0' && *begin != '1') || (value_ >> (WORD_BITS - 1)) != 0)
+    {
+      isValid_ = false;
+      return;
+    }
+    value_ = (value_ << 1) | static_cast< unsigned long long >(*begin - '0');
+    hasDigits_ = true;
+  }
+}
+
+bool kostyukov::BinUllDecoder::finish(unsigned long long& value) const noexcept
+{
+  if (!isValid_ || !hasDigits_)
+  {
+    return false;
+  }
+  value = isNegative_ ? 0 - value_ : value_;
+  return true;
+}
+
+bool kostyukov::decodeBinUll(const char* begin, const char* end, unsigned long long& value) noexcept
+{
+  BinUllDecoder decoder;
+  decoder.feed(begin, end);
+  return decoder.finish(value);
+}
@@ -0,0 +1,23 @@
+#ifndef BIN_ULL_DECODER_HPP
+#define BIN_ULL_DECODER_HPP
+
+namespace kostyukov
+{
+  class BinUllDecoder
+  {
+    public:
+      BinUllDecoder() noexcept;
+      void feed(const char* begin, const char* end) noexcept;
+      bool finish(unsigned long long& value) const noexcept;
+    private:
+      unsigned long long value_;
+      bool isLeading_;
+      bool hasSign_;
+      bool isNegative_;
+      bool hasDigits_;
+      bool isValid_;
+      void feedDigits(const char* begin, const char* end) noexcept;
+  };
+  bool decodeBinUll(const char* begin, const char* end, unsigned long long& value) noexcept;
+}
+#endif
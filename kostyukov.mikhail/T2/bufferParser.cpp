@@ -0,0 +1,279 @@
+#include "bufferParser.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+#include "binUllDecoder.hpp"
+#include "hexUllDecoder.hpp"
+#include "keyLabel.hpp"
+#include "scopeGuard.hpp"
+
+namespace
+{
+  const std::streamsize BLOCK_SIZE = 1 << 20;
+
+  bool isSpace(char c)
+  {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+  }
+
+  const char* skipSpaces(const char* pos, const char* end)
+  {
+    while (pos != end && isSpace(*pos))
+    {
+      ++pos;
+    }
+    return pos;
+  }
+
+  bool parseUll(const char* pos, const char* end, unsigned long long& value, int base)
+  {
+    if (base == 2)
+    {
+      return kostyukov::decodeBinUll(pos, end, value);
+    }
+    return kostyukov::decodeHexUll(pos, end, value);
+  }
+
+  const char* parseDelimiter(const char* pos, const char* end, char expected, bool& isParsed)
+  {
+    pos = skipSpaces(pos, end);
+    if (pos == end)
+    {
+      isParsed = false;
+      return pos;
+    }
+    isParsed = *pos == expected;
+    return pos + 1;
+  }
+
+  const char* parsePrefixedUll(const char* pos, const char* end, char prefix, int base,
+    unsigned long long& value, bool& isParsed)
+  {
+    isParsed = false;
+    if (pos == end || *pos != '0')
+    {
+      return pos;
+    }
+    ++pos;
+    if (pos == end || (*pos != prefix && *pos != prefix - 'a' + 'A'))
+    {
+      return pos;
+    }
+    ++pos;
+    const char* colon = static_cast< const char* >(std::memchr(pos, ':', end - pos));
+    if (!colon)
+    {
+      return end;
+    }
+    isParsed = parseUll(pos, colon, value, base);
+    return colon + 1;
+  }
+
+  const char* parseString(const char* pos, const char* end, const char*& first, const char*& last, bool& isParsed)
+  {
+    isParsed = false;
+    if (pos == end || *pos != '"')
+    {
+      return pos;
+    }
+    ++pos;
+    const char* quote = static_cast< const char* >(std::memchr(pos, '"', end - pos));
+    if (!quote)
+    {
+      return end;
+    }
+    first = pos;
+    last = quote;
+    return parseDelimiter(quote + 1, end, ':', isParsed);
+  }
+
+  void assignKey3(kostyukov::DataStruct& dest, const char* first, const char* last)
+  {
+    dest.key3.assign(first, last);
+  }
+
+  void assignKey3(kostyukov::DataStructRef& dest, const char* first, const char* last)
+  {
+    dest.key3 = first;
+    dest.key3Size = static_cast< size_t >(last - first);
+  }
+
+  template< class T >
+  using KeyParser = const char* (*)(const char*, const char*, T&, bool&);
+
+  template< class T >
+  const char* parseKey1(const char* pos, const char* end, T& dest, bool& isParsed)
+  {
+    return parsePrefixedUll(pos, end, 'b', 2, dest.key1, isParsed);
+  }
+
+  template< class T >
+  const char* parseKey2(const char* pos, const char* end, T& dest, bool& isParsed)
+  {
+    return parsePrefixedUll(pos, end, 'x', 16, dest.key2, isParsed);
+  }
+
+  template< class T >
+  const char* parseKey3(const char* pos, const char* end, T& dest, bool& isParsed)
+  {
+    const char* first = nullptr;
+    const char* last = nullptr;
+    pos = parseString(pos, end, first, last, isParsed);
+    if (isParsed)
+    {
+      assignKey3(dest, first, last);
+    }
+    return pos;
+  }
+
+  template< class T >
+  const char* parseUnknownKey(const char* pos, const char*, T&, bool& isParsed)
+  {
+    isParsed = false;
+    return pos;
+  }
+
+  template< class T >
+  const char* parseKey(size_t key, const char* pos, const char* end, T& dest, bool& isParsed)
+  {
+    static constexpr KeyParser< T > KEY_PARSERS[kostyukov::KEY_COUNT + 1] = {
+      parseKey1< T >, parseKey2< T >, parseKey3< T >, parseUnknownKey< T >
+    };
+    return KEY_PARSERS[key](pos, end, dest, isParsed);
+  }
+
+  template< class T >
+  const char* parseRecord(const char* begin, const char* end, T& dest, bool& isParsed)
+  {
+    const char* pos = parseDelimiter(begin, end, '(', isParsed);
+    if (isParsed)
+    {
+      pos = parseDelimiter(pos, end, ':', isParsed);
+    }
+    if (!isParsed)
+    {
+      return pos;
+    }
+    T temp{};
+    kostyukov::KeyRegister keys;
+    for (size_t i = 0; i < kostyukov::KEY_COUNT; ++i)
+    {
+      const char* label = skipSpaces(pos, end);
+      pos = label;
+      while (pos != end && !isSpace(*pos))
+      {
+        ++pos;
+      }
+      bool isLabel = label != end && static_cast< size_t >(pos - label) == kostyukov::KEY_LABEL_LENGTH;
+      size_t key = isLabel ? kostyukov::matchKeyLabel(label) : kostyukov::NOT_A_KEY;
+      if (key == kostyukov::NOT_A_KEY || (key != kostyukov::UNKNOWN_KEY && !keys.add(key)))
+      {
+        isParsed = false;
+        return pos;
+      }
+      pos = parseKey(key, skipSpaces(pos, end), end, temp, isParsed);
+      if (!isParsed)
+      {
+        return pos;
+      }
+    }
+    pos = parseDelimiter(pos, end, ')', isParsed);
+    if (isParsed)
+    {
+      dest = std::move(temp);
+    }
+    return pos;
+  }
+
+  template< class T >
+  void parseRecords(const char* begin, const char* end, std::vector< T >& data, kostyukov::ResyncMode mode)
+  {
+    const char* pos = begin;
+    while (pos != end)
+    {
+      T temp{};
+      bool isParsed = false;
+      pos = parseRecord(pos, end, temp, isParsed);
+      if (isParsed)
+      {
+        data.push_back(std::move(temp));
+      }
+      else
+      {
+        pos = kostyukov::resync(pos, end, mode);
+      }
+    }
+  }
+}
+
+void kostyukov::readBuffer(std::istream& in, std::vector< char >& buffer)
+{
+  buffer.clear();
+  std::size_t size = 0;
+  do
+  {
+    buffer.resize(size + BLOCK_SIZE);
+    in.read(buffer.data() + size, BLOCK_SIZE);
+    size += static_cast< std::size_t >(in.gcount());
+  }
+  while (in);
+  buffer.resize(size);
+}
+
+const char* kostyukov::skipLine(const char* pos, const char* end)
+{
+  const char* newline = static_cast< const char* >(std::memchr(pos, '\n', end - pos));
+  return newline ? newline + 1 : end;
+}
+
+const char* kostyukov::parseDataStruct(const char* begin, const char* end, DataStruct& dest, bool& isParsed)
+{
+  return parseRecord(begin, end, dest, isParsed);
+}
+
+const char* kostyukov::parseDataStruct(const char* begin, const char* end, DataStructRef& dest, bool& isParsed)
+{
+  return parseRecord(begin, end, dest, isParsed);
+}
+
+void kostyukov::parseBuffer(const char* begin, const char* end, std::vector< DataStruct >& data,
+  ResyncMode mode)
+{
+  parseRecords(begin, end, data, mode);
+}
+
+void kostyukov::parseBuffer(const char* begin, const char* end, std::vector< DataStructRef >& data,
+  ResyncMode mode)
+{
+  parseRecords(begin, end, data, mode);
+}
+
+bool kostyukov::DataStructRef::operator<(const DataStructRef& rhs) const
+{
+  if (key1 != rhs.key1)
+  {
+    return key1 < rhs.key1;
+  }
+  else if (key2 != rhs.key2)
+  {
+    return key2 < rhs.key2;
+  }
+  return key3Size < rhs.key3Size;
+}
+
+std::ostream& kostyukov::operator<<(std::ostream& out, const DataStructRef& dest)
+{
+  std::ostream::sentry sentry(out);
+  if (!sentry)
+  {
+    return out;
+  }
+  ScopeGuard scopeGrd(out);
+  out << "(:key1 " << BinUllIO{ dest.key1 };
+  out << ":key2 " << HexUllIO{ dest.key2 };
+  out << ":key3 \"";
+  out.write(dest.key3, static_cast< std::streamsize >(dest.key3Size));
+  return out << "\":)";
+}
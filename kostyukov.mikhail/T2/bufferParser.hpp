@@ -0,0 +1,30 @@
+#ifndef BUFFER_PARSER_HPP
+#define BUFFER_PARSER_HPP
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+#include "dataStruct.hpp"
+#include "resyncBuffer.hpp"
+
+namespace kostyukov
+{
+  struct DataStructRef
+  {
+    unsigned long long key1 = 0;
+    unsigned long long key2 = 0;
+    const char* key3 = nullptr;
+    size_t key3Size = 0;
+    bool operator<(const DataStructRef& rhs) const;
+  };
+  std::ostream& operator<<(std::ostream& out, const DataStructRef& dest);
+  void readBuffer(std::istream& in, std::vector< char >& buffer);
+  const char* skipLine(const char* pos, const char* end);
+  const char* parseDataStruct(const char* begin, const char* end, DataStruct& dest, bool& isParsed);
+  const char* parseDataStruct(const char* begin, const char* end, DataStructRef& dest, bool& isParsed);
+  void parseBuffer(const char* begin, const char* end, std::vector< DataStruct >& data,
+    ResyncMode mode);
+  void parseBuffer(const char* begin, const char* end, std::vector< DataStructRef >& data,
+    ResyncMode mode);
+}
+#endif
@@ -0,0 +1,76 @@
+#include "bulkWriter.hpp"
+
+#include <cstring>
+
+#include "ullFormat.hpp"
+
+kostyukov::BulkWriter::BulkWriter(std::FILE* file, size_t capacity):
+  file_(file),
+  buffer_(capacity),
+  size_(0),
+  isGood_(true)
+{}
+
+kostyukov::BulkWriter::~BulkWriter()
+{
+  flush();
+}
+
+void kostyukov::BulkWriter::write(const DataStruct& value)
+{
+  writeRecord(value.key1, value.key2, value.key3.data(), value.key3.size());
+}
+
+void kostyukov::BulkWriter::write(const DataStructRef& value)
+{
+  writeRecord(value.key1, value.key2, value.key3, value.key3Size);
+}
+
+bool kostyukov::BulkWriter::flush()
+{
+  if (std::fwrite(buffer_.data(), 1, size_, file_) != size_)
+  {
+    isGood_ = false;
+  }
+  size_ = 0;
+  if (std::fflush(file_) != 0)
+  {
+    isGood_ = false;
+  }
+  return isGood_;
+}
+
+void kostyukov::BulkWriter::writeRecord(unsigned long long key1, unsigned long long key2, const char* key3,
+  size_t key3Size)
+{
+  const size_t MAX_KEYS_LENGTH = 32 + BIN_ULL_MAX_LENGTH + HEX_ULL_MAX_LENGTH;
+  if (buffer_.size() - size_ < MAX_KEYS_LENGTH)
+  {
+    flush();
+  }
+  append("(:key1 ", 7);
+  size_ += formatBinUll(key1, buffer_.data() + size_);
+  append(":key2 ", 6);
+  size_ += formatHexUll(key2, buffer_.data() + size_);
+  append(":key3 \"", 7);
+  append(key3, key3Size);
+  append("\":)\n", 4);
+}
+
+void kostyukov::BulkWriter::append(const char* data, size_t size)
+{
+  if (buffer_.size() - size_ < size)
+  {
+    flush();
+    if (buffer_.size() < size)
+    {
+      if (std::fwrite(data, 1, size, file_) != size)
+      {
+        isGood_ = false;
+      }
+      return;
+    }
+  }
+  std::memcpy(buffer_.data() + size_, data, size);
+  size_ += size;
+}
@@ -0,0 +1,33 @@
+#ifndef BULK_WRITER_HPP
+#define BULK_WRITER_HPP
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+#include "bufferParser.hpp"
+#include "dataStruct.hpp"
+
+namespace kostyukov
+{
+  class BulkWriter
+  {
+    public:
+      explicit BulkWriter(std::FILE* file, size_t capacity = 1 << 22);
+      ~BulkWriter();
+      BulkWriter(const BulkWriter&) = delete;
+      BulkWriter(BulkWriter&&) = delete;
+      BulkWriter& operator=(const BulkWriter&) = delete;
+      BulkWriter& operator=(BulkWriter&&) = delete;
+      void write(const DataStruct& value);
+      void write(const DataStructRef& value);
+      bool flush();
+    private:
+      std::FILE* file_;
+      std::vector< char > buffer_;
+      size_t size_;
+      bool isGood_;
+      void writeRecord(unsigned long long key1, unsigned long long key2, const char* key3, size_t key3Size);
+      void append(const char* data, size_t size);
+  };
+}
+#endif
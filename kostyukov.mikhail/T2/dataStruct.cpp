@@ -1,13 +1,14 @@
 #include "dataStruct.hpp"
 
-#include <bitset>
 #include <cctype>
-#include <iomanip>
 #include <iostream>
-#include <limits>
 #include <string>
 
+#include "binUllDecoder.hpp"
+#include "hexUllDecoder.hpp"
+#include "keyLabel.hpp"
 #include "scopeGuard.hpp"
+#include "ullFormat.hpp"
 
 std::istream& kostyukov::operator>>(std::istream& in, DelimiterIO&& dest)
 {
@@ -39,29 +40,101 @@ std::istream& kostyukov::operator>>(std::istream& in, StringIO&& dest)
   return in;
 }
 
-bool readUll(std::istream& in, unsigned long long& value, size_t base)
+template< class Decoder >
+bool readEncodedUll(std::istream& in, unsigned long long& value)
 {
-  std::string digits;
-  std::getline(in, digits, ':');
-  if (digits.empty())
+  const std::streamsize CHUNK_SIZE = 64;
+  char chunk[CHUNK_SIZE];
+  Decoder decoder;
+  std::streamsize total = 0;
+  bool isChunkFull = true;
+  while (isChunkFull)
+  {
+    in.getline(chunk, CHUNK_SIZE, ':');
+    std::streamsize count = in.gcount();
+    isChunkFull = in.fail() && !in.eof() && count == CHUNK_SIZE - 1;
+    bool isDelimited = !in.fail() && !in.eof();
+    decoder.feed(chunk, chunk + (isDelimited ? count - 1 : count));
+    total += count;
+    if (isChunkFull || (in.eof() && total != 0))
+    {
+      in.clear(in.rdstate() & ~std::ios::failbit);
+    }
+  }
+  return decoder.finish(value);
+}
+
+namespace
+{
+  using KeyReader = bool (*)(std::istream&, kostyukov::DataStruct&);
+
+  bool readKeyLabel(std::istream& in, char* label)
   {
-    return false;
+    std::istream::sentry sentry(in);
+    if (!sentry)
+    {
+      return false;
+    }
+    using Traits = std::istream::traits_type;
+    std::streambuf* buf = in.rdbuf();
+    size_t length = 0;
+    Traits::int_type c = buf->sgetc();
+    for (; !Traits::eq_int_type(c, Traits::eof()) && !std::isspace(c); c = buf->snextc())
+    {
+      if (length < kostyukov::KEY_LABEL_LENGTH)
+      {
+        label[length] = Traits::to_char_type(c);
+      }
+      ++length;
+    }
+    if (Traits::eq_int_type(c, Traits::eof()))
+    {
+      in.setstate(std::ios::eofbit);
+    }
+    return length == kostyukov::KEY_LABEL_LENGTH;
   }
-  try
+
+  bool skipPrefix(std::istream& in, char prefix)
   {
-    size_t processedChars = 0;
-    unsigned long long tempValue = std::stoull(digits, &processedChars, base);
-    if (processedChars != digits.length())
+    if (in.peek() != '0')
     {
       return false;
     }
-    value = tempValue;
+    in.ignore();
+    if (std::tolower(in.peek()) != prefix)
+    {
+      return false;
+    }
+    in.ignore();
     return true;
   }
-  catch (const std::exception&)
+
+  bool readKey1(std::istream& in, kostyukov::DataStruct& dest)
+  {
+    return skipPrefix(in, 'b') && readEncodedUll< kostyukov::BinUllDecoder >(in, dest.key1);
+  }
+
+  bool readKey2(std::istream& in, kostyukov::DataStruct& dest)
+  {
+    return skipPrefix(in, 'x') && readEncodedUll< kostyukov::HexUllDecoder >(in, dest.key2);
+  }
+
+  bool readKey3(std::istream& in, kostyukov::DataStruct& dest)
+  {
+    if (in.peek() != '"')
+    {
+      return false;
+    }
+    in >> kostyukov::StringIO{ dest.key3 };
+    return static_cast< bool >(in);
+  }
+
+  bool readUnknownKey(std::istream&, kostyukov::DataStruct&)
   {
     return false;
   }
+
+  constexpr KeyReader KEY_READERS[kostyukov::KEY_COUNT + 1] = { readKey1, readKey2, readKey3, readUnknownKey };
 }
 
 std::istream& kostyukov::operator>>(std::istream& in, DataStruct& dest)
@@ -78,79 +151,18 @@ std::istream& kostyukov::operator>>(std::istream& in, DataStruct& dest)
     return in;
   }
   DataStruct temp{};
-  const size_t EXPECTED_KEY_COUNT = 3;
-  const size_t KEY_NAME_LENGTH = 4;
-  for (size_t i = 0; i < EXPECTED_KEY_COUNT; ++i)
+  kostyukov::KeyRegister keys;
+  for (size_t i = 0; i < kostyukov::KEY_COUNT; ++i)
   {
-    std::string key = "";
-    in >> key;
-    if (!in || key.length() != KEY_NAME_LENGTH || key.substr(0, 3) != "key")
+    char label[kostyukov::KEY_LABEL_LENGTH] = {};
+    size_t key = readKeyLabel(in, label) ? kostyukov::matchKeyLabel(label) : kostyukov::NOT_A_KEY;
+    if (!in || key == kostyukov::NOT_A_KEY || (key != kostyukov::UNKNOWN_KEY && !keys.add(key)))
     {
       in.setstate(std::ios::failbit);
       return in;
     }
-    char keyNum = key.back();
-    bool readSuccess = false;
     in >> std::ws;
-    if (keyNum == '1')
-    {
-      if (in.peek() == '0')
-      {
-        in.ignore();
-        char nextChar = static_cast<char>(std::tolower(in.peek()));
-        if (nextChar == 'b')
-        {
-          in.ignore();
-          readSuccess = readUll(in, temp.key1, 2);
-        }
-        else
-        {
-          readSuccess = false;
-        }
-      }
-      else
-      {
-        readSuccess = false;
-      }
-    }
-    else if (keyNum == '2')
-    {
-      if (in.peek() == '0')
-      {
-        in.ignore();
-        char nextChar = static_cast<char>(std::tolower(in.peek()));
-        if (nextChar == 'x')
-        {
-          in.ignore();
-          readSuccess = readUll(in, temp.key2, 16);
-        }
-        else
-        {
-          readSuccess = false;
-        }
-      }
-      else
-      {
-        readSuccess = false;
-      }
-    }
-    else if (keyNum == '3')
-    {
-      if (in.peek() == '"')
-      {
-        in >> StringIO{ temp.key3 };
-        readSuccess = static_cast<bool>(in);
-      }
-      else
-      {
-        readSuccess = false;
-      }
-    }
-    else
-    {
-      readSuccess = false;
-    }
-    if (!readSuccess && in.good())
+    if (!KEY_READERS[key](in, temp) && in.good())
     {
       in.setstate(std::ios::failbit);
       return in;
@@ -171,35 +183,8 @@ std::ostream& kostyukov::operator<<(std::ostream& out, BinUllIO&& dest)
   {
     return out;
   }
-  ScopeGuard scopeGrd(out);
-  out << "0b";
-  if (dest.value == 0)
-  {
-    out << '0';
-    return out;
-  }
-  const size_t ULL_BIT_COUNT = std::numeric_limits< unsigned long long >::digits;
-  std::bitset< ULL_BIT_COUNT > bits(dest.value);
-  bool leadingZeros = true;
-  if (dest.value == 1)
-  {
-    out << "01";
-    return out;
-  }
-  for (size_t i = 0; i < ULL_BIT_COUNT; ++i)
-  {
-    size_t bit_index = ULL_BIT_COUNT - 1 - i;
-    if (bits[bit_index])
-    {
-      leadingZeros = false;
-      out << '1';
-    }
-    else if (!leadingZeros)
-    {
-      out << '0';
-    }
-  }
-  return out;
+  char buffer[BIN_ULL_MAX_LENGTH];
+  return out.write(buffer, static_cast< std::streamsize >(formatBinUll(dest.value, buffer)));
 }
 
 std::ostream& kostyukov::operator<<(std::ostream& out, HexUllIO&& dest)
@@ -209,9 +194,8 @@ std::ostream& kostyukov::operator<<(std::ostream& out, HexUllIO&& dest)
   {
     return out;
   }
-  ScopeGuard scopeGrd(out);
-  out << "0x" << std::hex << std::uppercase << dest.value;
-  return out;
+  char buffer[HEX_ULL_MAX_LENGTH];
+  return out.write(buffer, static_cast< std::streamsize >(formatHexUll(dest.value, buffer)));
 }
 
 std::ostream& kostyukov::operator<<(std::ostream& out, ConstStringIO&& dest)
@@ -0,0 +1,95 @@
+#include "dataStructStore.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+namespace
+{
+  template< class T >
+  void permute(std::vector< T >& values, const std::vector< size_t >& order)
+  {
+    std::vector< T > permuted;
+    permuted.reserve(values.size());
+    for (size_t index: order)
+    {
+      permuted.push_back(values[index]);
+    }
+    values.swap(permuted);
+  }
+}
+
+void kostyukov::DataStructStore::push_back(const DataStruct& value)
+{
+  pushKeys(value.key1, value.key2, value.key3.data(), value.key3.size());
+}
+
+void kostyukov::DataStructStore::push_back(const DataStructRef& value)
+{
+  pushKeys(value.key1, value.key2, value.key3, value.key3Size);
+}
+
+void kostyukov::DataStructStore::reserve(size_t count, size_t key3Bytes)
+{
+  key1_.reserve(count);
+  key2_.reserve(count);
+  key3Offsets_.reserve(count);
+  key3Sizes_.reserve(count);
+  arena_.reserve(key3Bytes);
+}
+
+size_t kostyukov::DataStructStore::size() const noexcept
+{
+  return key1_.size();
+}
+
+kostyukov::DataStructRef kostyukov::DataStructStore::operator[](size_t index) const noexcept
+{
+  return { key1_[index], key2_[index], arena_.data() + key3Offsets_[index], key3Sizes_[index] };
+}
+
+void kostyukov::DataStructStore::sort()
+{
+  std::vector< size_t > order(size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [this](size_t lhs, size_t rhs)
+  {
+    if (key1_[lhs] != key1_[rhs])
+    {
+      return key1_[lhs] < key1_[rhs];
+    }
+    else if (key2_[lhs] != key2_[rhs])
+    {
+      return key2_[lhs] < key2_[rhs];
+    }
+    return key3Sizes_[lhs] < key3Sizes_[rhs];
+  });
+  permute(key1_, order);
+  permute(key2_, order);
+  permute(key3Offsets_, order);
+  permute(key3Sizes_, order);
+}
+
+void kostyukov::DataStructStore::pushKeys(unsigned long long key1, unsigned long long key2, const char* key3,
+  size_t key3Size)
+{
+  key1_.push_back(key1);
+  key2_.push_back(key2);
+  key3Offsets_.push_back(arena_.size());
+  key3Sizes_.push_back(key3Size);
+  arena_.insert(arena_.end(), key3, key3 + key3Size);
+}
+
+std::ostream& kostyukov::operator<<(std::ostream& out, const DataStructStore& store)
+{
+  std::ostream::sentry sentry(out);
+  if (!sentry)
+  {
+    return out;
+  }
+  for (size_t i = 0; i < store.size(); ++i)
+  {
+    out << store[i] << '\n';
+  }
+  return out;
+}
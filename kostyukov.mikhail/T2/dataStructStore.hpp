@@ -0,0 +1,32 @@
+#ifndef DATA_STRUCT_STORE_HPP
+#define DATA_STRUCT_STORE_HPP
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+#include "bufferParser.hpp"
+#include "dataStruct.hpp"
+
+namespace kostyukov
+{
+  class DataStructStore
+  {
+    public:
+      using value_type = DataStruct;
+      void push_back(const DataStruct& value);
+      void push_back(const DataStructRef& value);
+      void reserve(size_t count, size_t key3Bytes);
+      size_t size() const noexcept;
+      DataStructRef operator[](size_t index) const noexcept;
+      void sort();
+    private:
+      std::vector< unsigned long long > key1_;
+      std::vector< unsigned long long > key2_;
+      std::vector< size_t > key3Offsets_;
+      std::vector< size_t > key3Sizes_;
+      std::vector< char > arena_;
+      void pushKeys(unsigned long long key1, unsigned long long key2, const char* key3, size_t key3Size);
+  };
+  std::ostream& operator<<(std::ostream& out, const DataStructStore& store);
+}
+#endif
@@ -0,0 +1,103 @@
+#include "hexBenchmark.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "hexUllDecoder.hpp"
+#include "ullFormat.hpp"
+
+namespace
+{
+  const size_t ROUNDS = 1000000;
+
+  template< class Kernel >
+  double measure(Kernel kernel, unsigned long long& checksum)
+  {
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    for (size_t i = 0; i < ROUNDS; ++i)
+    {
+      checksum += kernel(i);
+    }
+    std::chrono::duration< double, std::nano > elapsed = Clock::now() - start;
+    return elapsed.count() / ROUNDS;
+  }
+
+  unsigned long long decodeWithStoull(const std::string& token)
+  {
+    try
+    {
+      size_t processed = 0;
+      unsigned long long value = std::stoull(token, &processed, 16);
+      return processed == token.size() ? value : 0;
+    }
+    catch (const std::exception&)
+    {
+      return 0;
+    }
+  }
+
+  unsigned long long decodeWithDecoder(const std::string& token)
+  {
+    unsigned long long value = 0;
+    return kostyukov::decodeHexUll(token.data(), token.data() + token.size(), value) ? value : 0;
+  }
+
+  template< class Decode >
+  double measureDecode(const std::vector< std::string >& tokens, Decode decode, unsigned long long& checksum)
+  {
+    return measure([&tokens, decode](size_t i)
+    {
+      return decode(tokens[i % tokens.size()]);
+    }, checksum);
+  }
+}
+
+void kostyukov::benchmarkHexUll(std::ostream& out)
+{
+  const std::vector< std::string > tokens{
+    "0", "1F", "DEADBEEF", "c0ffee42", "1234567890ABCDEF", "ffffffffffffffff", "10000000000000000", "12G4"
+  };
+  const std::vector< std::string > malformed{
+    "", "-", "0x", "12G4", "DEAD BEEF", "10000000000000000", "+-1", "ffffffffffffffff0"
+  };
+  const std::vector< unsigned long long > values{
+    0, 0x1F, 0xDEADBEEF, 0xC0FFEE42, 0x1234567890ABCDEF, 0xFFFFFFFFFFFFFFFF
+  };
+  unsigned long long streamDecodeSum = 0;
+  unsigned long long decoderSum = 0;
+  double stoullTime = measureDecode(tokens, decodeWithStoull, streamDecodeSum);
+  double decoderTime = measureDecode(tokens, decodeWithDecoder, decoderSum);
+  double malformedStoullTime = measureDecode(malformed, decodeWithStoull, streamDecodeSum);
+  double malformedDecoderTime = measureDecode(malformed, decodeWithDecoder, decoderSum);
+
+  std::ostringstream stream;
+  unsigned long long streamEncodeSum = 0;
+  unsigned long long encoderSum = 0;
+  double streamTime = measure([&values, &stream](size_t i)
+  {
+    stream.str("");
+    stream << "0x" << std::hex << std::uppercase << values[i % values.size()];
+    std::string text = stream.str();
+    return static_cast< unsigned long long >(text.size()) + static_cast< unsigned char >(text.back());
+  }, streamEncodeSum);
+  double encoderTime = measure([&values](size_t i)
+  {
+    char buffer[HEX_ULL_MAX_LENGTH];
+    size_t length = formatHexUll(values[i % values.size()], buffer);
+    return static_cast< unsigned long long >(length) + static_cast< unsigned char >(buffer[length - 1]);
+  }, encoderSum);
+
+  out << "hex decode, std::stoull + catch:    " << stoullTime << " ns\n";
+  out << "hex decode, decodeHexUll:           " << decoderTime << " ns\n";
+  out << "malformed hex, std::stoull + catch: " << malformedStoullTime << " ns\n";
+  out << "malformed hex, decodeHexUll:        " << malformedDecoderTime << " ns\n";
+  out << "hex encode, std::hex << uppercase:  " << streamTime << " ns\n";
+  out << "hex encode, formatHexUll:           " << encoderTime << " ns\n";
+  bool isMatching = streamDecodeSum == decoderSum && streamEncodeSum == encoderSum;
+  out << (isMatching ? "results match\n" : "<RESULTS MISMATCH>\n");
+}
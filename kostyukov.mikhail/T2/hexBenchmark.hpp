@@ -0,0 +1,9 @@
+#ifndef HEX_BENCHMARK_HPP
+#define HEX_BENCHMARK_HPP
+#include <iosfwd>
+
+namespace kostyukov
+{
+  void benchmarkHexUll(std::ostream& out);
+}
+#endif
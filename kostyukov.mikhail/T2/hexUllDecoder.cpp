@@ -0,0 +1,165 @@
+#include "hexUllDecoder.hpp"
+
+#include <cstddef>
+
+namespace
+{
+  const unsigned long long HIGH_BITS = 0x8080808080808080ull;
+  const unsigned long long LOW_NIBBLES = 0x0F0F0F0F0F0F0F0Full;
+  const unsigned long long LOWER_CASE_BITS = 0x2020202020202020ull;
+  const unsigned long long DIGIT_FLOOR = 0x5050505050505050ull;
+  const unsigned long long DIGIT_CEILING = 0x4646464646464646ull;
+  const unsigned long long LETTER_FLOOR = 0x1F1F1F1F1F1F1F1Full;
+  const unsigned long long LETTER_CEILING = 0x1919191919191919ull;
+  const unsigned long long LETTER_OFFSET = 9;
+  const int WORD_BYTES = 8;
+  const int BYTE_BITS = 8;
+  const int NIBBLE_BITS = 4;
+  const int WORD_BITS = 64;
+  const unsigned char NOT_A_NIBBLE = 0xFF;
+
+  struct NibbleTable
+  {
+    unsigned char values[256];
+    constexpr NibbleTable():
+      values()
+    {
+      for (size_t c = 0; c < 256; ++c)
+      {
+        values[c] = NOT_A_NIBBLE;
+      }
+      for (size_t i = 0; i < 10; ++i)
+      {
+        values['0' + i] = static_cast< unsigned char >(i);
+      }
+      for (size_t i = 0; i < 6; ++i)
+      {
+        values['a' + i] = static_cast< unsigned char >(10 + i);
+        values['A' + i] = static_cast< unsigned char >(10 + i);
+      }
+    }
+  };
+
+  constexpr NibbleTable NIBBLE_TABLE{};
+
+  unsigned long long loadWord(const char* pos) noexcept
+  {
+    unsigned long long word = 0;
+    for (int i = 0; i < WORD_BYTES; ++i)
+    {
+      word |= static_cast< unsigned long long >(static_cast< unsigned char >(pos[i])) << (i * BYTE_BITS);
+    }
+    return word;
+  }
+
+  bool decodeWord(unsigned long long word, unsigned long long& nibbles) noexcept
+  {
+    if ((word & HIGH_BITS) != 0)
+    {
+      return false;
+    }
+    unsigned long long folded = word | LOWER_CASE_BITS;
+    unsigned long long digits = (word + DIGIT_FLOOR) & ~(word + DIGIT_CEILING);
+    unsigned long long letters = (folded + LETTER_FLOOR) & ~(folded + LETTER_CEILING);
+    if (((digits | letters) & HIGH_BITS) != HIGH_BITS)
+    {
+      return false;
+    }
+    unsigned long long packed = (word & LOW_NIBBLES) + ((letters & HIGH_BITS) >> 7) * LETTER_OFFSET;
+    packed = ((packed << 4) | (packed >> 8)) & 0x00FF00FF00FF00FFull;
+    packed = ((packed << 8) | (packed >> 16)) & 0x0000FFFF0000FFFFull;
+    nibbles = ((packed << 16) | (packed >> 32)) & 0x00000000FFFFFFFFull;
+    return true;
+  }
+
+  bool isSpace(char c) noexcept
+  {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+  }
+}
+
+kostyukov::HexUllDecoder::HexUllDecoder() noexcept:
+  value_(0),
+  isLeading_(true),
+  hasSign_(false),
+  isNegative_(false),
+  hasDigits_(false),
+  isValid_(true)
+{}
+
+void kostyukov::HexUllDecoder::feed(const char* begin, const char* end) noexcept
+{
+  while (isLeading_ && begin != end)
+  {
+    if (!hasSign_ && !hasDigits_ && isSpace(*begin))
+    {
+      ++begin;
+    }
+    else if (!hasSign_ && !hasDigits_ && (*begin == '+' || *begin == '-'))
+    {
+      hasSign_ = true;
+      isNegative_ = *begin == '-';
+      ++begin;
+    }
+    else if (!hasDigits_ && *begin == '0')
+    {
+      hasDigits_ = true;
+      ++begin;
+    }
+    else if (hasDigits_ && (*begin == 'x' || *begin == 'X'))
+    {
+      hasDigits_ = false;
+      isLeading_ = false;
+      ++begin;
+    }
+    else
+    {
+      isLeading_ = false;
+    }
+  }
+  feedDigits(begin, end);
+}
+
+void kostyukov::HexUllDecoder::feedDigits(const char* begin, const char* end) noexcept
+{
+  const int WORD_NIBBLES = WORD_BYTES * NIBBLE_BITS;
+  for (; isValid_ && end - begin >= WORD_BYTES; begin += WORD_BYTES)
+  {
+    unsigned long long nibbles = 0;
+    if (!decodeWord(loadWord(begin), nibbles) || (value_ >> (WORD_BITS - WORD_NIBBLES)) != 0)
+    {
+      isValid_ = false;
+      return;
+    }
+    value_ = (value_ << WORD_NIBBLES) | nibbles;
+    hasDigits_ = true;
+  }
+  for (; isValid_ && begin != end; ++begin)
+  {
+    unsigned char nibble = NIBBLE_TABLE.values[static_cast< unsigned char >(*begin)];
+    if (nibble == NOT_A_NIBBLE || (value_ >> (WORD_BITS - NIBBLE_BITS)) != 0)
+    {
+      isValid_ = false;
+      return;
+    }
+    value_ = (value_ << NIBBLE_BITS) | nibble;
+    hasDigits_ = true;
+  }
+}
+
+bool kostyukov::HexUllDecoder::finish(unsigned long long& value) const noexcept
+{
+  if (!isValid_ || !hasDigits_)
+  {
+    return false;
+  }
+  value = isNegative_ ? 0 - value_ : value_;
+  return true;
+}
+
+bool kostyukov::decodeHexUll(const char* begin, const char* end, unsigned long long& value) noexcept
+{
+  HexUllDecoder decoder;
+  decoder.feed(begin, end);
+  return decoder.finish(value);
+}
@@ -0,0 +1,23 @@
+#ifndef HEX_ULL_DECODER_HPP
+#define HEX_ULL_DECODER_HPP
+
+namespace kostyukov
+{
+  class HexUllDecoder
+  {
+    public:
+      HexUllDecoder() noexcept;
+      void feed(const char* begin, const char* end) noexcept;
+      bool finish(unsigned long long& value) const noexcept;
+    private:
+      unsigned long long value_;
+      bool isLeading_;
+      bool hasSign_;
+      bool isNegative_;
+      bool hasDigits_;
+      bool isValid_;
+      void feedDigits(const char* begin, const char* end) noexcept;
+  };
+  bool decodeHexUll(const char* begin, const char* end, unsigned long long& value) noexcept;
+}
+#endif
@@ -0,0 +1,34 @@
+#include "keyLabel.hpp"
+
+#include <cstring>
+
+namespace
+{
+  constexpr std::uint32_t KEY_BASE_WORD = kostyukov::makeLabelWord("key0");
+  constexpr std::uint32_t KEY_PREFIX_MASK = kostyukov::makeLabelWord("\xFF\xFF\xFF");
+}
+
+size_t kostyukov::matchKeyLabel(const char* label) noexcept
+{
+  std::uint32_t word = 0;
+  std::memcpy(&word, label, KEY_LABEL_LENGTH);
+  std::uint32_t diff = word ^ KEY_BASE_WORD;
+  if ((diff & KEY_PREFIX_MASK) != 0)
+  {
+    return NOT_A_KEY;
+  }
+  size_t number = static_cast< size_t >((diff | diff >> 8 | diff >> 16 | diff >> 24) & 0xFF);
+  return number - 1 < KEY_COUNT ? number - 1 : UNKNOWN_KEY;
+}
+
+kostyukov::KeyRegister::KeyRegister() noexcept:
+  mask_(0)
+{}
+
+bool kostyukov::KeyRegister::add(size_t key) noexcept
+{
+  unsigned bit = 1u << key;
+  bool isNew = (mask_ & bit) == 0;
+  mask_ |= bit;
+  return isNew;
+}
@@ -0,0 +1,39 @@
+#ifndef KEY_LABEL_HPP
+#define KEY_LABEL_HPP
+#include <cstddef>
+#include <cstdint>
+
+namespace kostyukov
+{
+  const size_t KEY_LABEL_LENGTH = 4;
+  const size_t KEY_COUNT = 3;
+  const size_t UNKNOWN_KEY = KEY_COUNT;
+  const size_t NOT_A_KEY = KEY_COUNT + 1;
+
+  constexpr std::uint32_t makeLabelWord(const char* label) noexcept
+  {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return static_cast< std::uint32_t >(static_cast< unsigned char >(label[0]))
+      | static_cast< std::uint32_t >(static_cast< unsigned char >(label[1])) << 8
+      | static_cast< std::uint32_t >(static_cast< unsigned char >(label[2])) << 16
+      | static_cast< std::uint32_t >(static_cast< unsigned char >(label[3])) << 24;
+#else
+    return static_cast< std::uint32_t >(static_cast< unsigned char >(label[0])) << 24
+      | static_cast< std::uint32_t >(static_cast< unsigned char >(label[1])) << 16
+      | static_cast< std::uint32_t >(static_cast< unsigned char >(label[2])) << 8
+      | static_cast< std::uint32_t >(static_cast< unsigned char >(label[3]));
+#endif
+  }
+
+  size_t matchKeyLabel(const char* label) noexcept;
+
+  class KeyRegister
+  {
+    public:
+      KeyRegister() noexcept;
+      bool add(size_t key) noexcept;
+    private:
+      unsigned mask_;
+  };
+}
+#endif
@@ -1,27 +1,333 @@
 #include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <vector>
 
+#include "bufferParser.hpp"
+#include "bulkWriter.hpp"
 #include "dataStruct.hpp"
+#include "dataStructStore.hpp"
+#include "hexBenchmark.hpp"
+#include "mappedFile.hpp"
+#include "parallelParser.hpp"
+#include "radixSort.hpp"
+#include "recordSelector.hpp"
+#include "resyncBuffer.hpp"
 
-int main()
+namespace
 {
   using kostyukov::DataStruct;
-  using DataStructInputIt = std::istream_iterator< DataStruct >;
-  using DataStructOutputIt = std::ostream_iterator< DataStruct >;
+  using kostyukov::DataStructRef;
+
+  struct Options
+  {
+    bool useBuffer = false;
+    bool check = false;
+    const char* path = nullptr;
+    size_t threadCount = 1;
+    bool useRadixSort = false;
+    bool useStore = false;
+    bool useBulkOutput = false;
+    kostyukov::ResyncMode resyncMode = kostyukov::ResyncMode::LINE;
+    bool useSelector = false;
+    size_t topCount = kostyukov::UNLIMITED_RECORDS;
+    unsigned long long minKey1 = 0;
+    unsigned long long maxKey1 = std::numeric_limits< unsigned long long >::max();
+    bool useBenchmark = false;
+  };
+
+  bool parseUll(const char* text, int base, unsigned long long& value)
+  {
+    if (!std::isdigit(static_cast< unsigned char >(*text)))
+    {
+      return false;
+    }
+    char* last = nullptr;
+    value = std::strtoull(text, &last, base);
+    return *last == '\0';
+  }
+
+  bool parseOptions(int argc, char* argv[], Options& options)
+  {
+    for (int i = 1; i < argc; ++i)
+    {
+      if (std::strcmp(argv[i], "--buffer") == 0)
+      {
+        options.useBuffer = true;
+      }
+      else if (std::strcmp(argv[i], "--check") == 0)
+      {
+        options.useBuffer = true;
+        options.check = true;
+      }
+      else if (std::strcmp(argv[i], "--mmap") == 0 && i + 1 < argc)
+      {
+        options.path = argv[++i];
+      }
+      else if (std::strcmp(argv[i], "--radix") == 0)
+      {
+        options.useRadixSort = true;
+      }
+      else if (std::strcmp(argv[i], "--soa") == 0)
+      {
+        options.useStore = true;
+      }
+      else if (std::strcmp(argv[i], "--bulk-output") == 0)
+      {
+        options.useBulkOutput = true;
+      }
+      else if (std::strcmp(argv[i], "--bench") == 0 && argc == 2)
+      {
+        options.useBenchmark = true;
+      }
+      else if (std::strcmp(argv[i], "--resync-record") == 0)
+      {
+        options.resyncMode = kostyukov::ResyncMode::RECORD;
+      }
+      else if (std::strcmp(argv[i], "--top") == 0 && i + 1 < argc)
+      {
+        unsigned long long count = 0;
+        if (!parseUll(argv[++i], 10, count))
+        {
+          return false;
+        }
+        options.useSelector = true;
+        const unsigned long long MAX_COUNT = kostyukov::UNLIMITED_RECORDS - 1;
+        options.topCount = static_cast< size_t >(std::min(count, MAX_COUNT));
+      }
+      else if (std::strcmp(argv[i], "--range") == 0 && i + 2 < argc)
+      {
+        if (!parseUll(argv[i + 1], 0, options.minKey1) || !parseUll(argv[i + 2], 0, options.maxKey1))
+        {
+          return false;
+        }
+        options.useSelector = true;
+        i += 2;
+      }
+      else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+      {
+        unsigned long long count = 0;
+        if (!parseUll(argv[++i], 10, count))
+        {
+          return false;
+        }
+        options.useBuffer = true;
+        const unsigned long long MAX_THREADS = std::max(1u, std::thread::hardware_concurrency());
+        options.threadCount = static_cast< size_t >(count != 0 ? std::min(count, MAX_THREADS) : MAX_THREADS);
+      }
+      else
+      {
+        return false;
+      }
+    }
+    bool isSelectorCompatible = !(options.useBuffer || options.path || options.useStore || options.useRadixSort);
+    return !(options.check && (options.path || options.useStore)) && !(options.useRadixSort && options.useStore)
+      && (!options.useSelector || isSelectorCompatible);
+  }
+
+  template< class Container >
+  void readStream(std::streambuf* source, Container& data, kostyukov::ResyncMode mode)
+  {
+    using DataStructInputIt = std::istream_iterator< DataStruct >;
+    kostyukov::ResyncBuffer buffer(source);
+    std::istream in(&buffer);
+    while (!in.eof())
+    {
+      std::copy(DataStructInputIt(in), DataStructInputIt(), std::back_inserter(data));
+      if (in.fail())
+      {
+        in.clear();
+        if (!buffer.skip(mode))
+        {
+          in.setstate(std::ios::eofbit);
+        }
+      }
+    }
+  }
+
+  template< class T >
+  void parse(const char* begin, const char* end, std::vector< T >& data, const Options& options)
+  {
+    if (options.threadCount > 1)
+    {
+      kostyukov::parseBufferParallel(begin, end, data, options.threadCount, options.resyncMode);
+    }
+    else
+    {
+      kostyukov::parseBuffer(begin, end, data, options.resyncMode);
+    }
+  }
+
+  template< class T >
+  bool print(const std::vector< T >& data, const Options& options)
+  {
+    if (options.useBulkOutput)
+    {
+      kostyukov::BulkWriter writer(stdout);
+      for (const T& record: data)
+      {
+        writer.write(record);
+      }
+      return writer.flush();
+    }
+    std::copy(std::begin(data), std::end(data), std::ostream_iterator< T >(std::cout, "\n"));
+    return static_cast< bool >(std::cout.flush());
+  }
+
+  template< class T >
+  bool sortAndPrint(std::vector< T >& data, const Options& options)
+  {
+    if (options.useRadixSort)
+    {
+      kostyukov::radixSort(data);
+    }
+    else
+    {
+      std::sort(data.begin(), data.end());
+    }
+    return print(data, options);
+  }
+
+  bool processMappedFile(const Options& options)
+  {
+    kostyukov::MappedFile file(options.path);
+    std::vector< DataStructRef > data;
+    parse(file.begin(), file.end(), data, options);
+    return sortAndPrint(data, options);
+  }
+
+  void fillStore(const std::vector< DataStructRef >& data, kostyukov::DataStructStore& store)
+  {
+    size_t key3Bytes = 0;
+    for (const DataStructRef& record: data)
+    {
+      key3Bytes += record.key3Size;
+    }
+    store.reserve(data.size(), key3Bytes);
+    for (const DataStructRef& record: data)
+    {
+      store.push_back(record);
+    }
+  }
+
+  bool processStore(const Options& options)
+  {
+    kostyukov::DataStructStore store;
+    std::vector< DataStructRef > data;
+    if (options.path)
+    {
+      kostyukov::MappedFile file(options.path);
+      parse(file.begin(), file.end(), data, options);
+      fillStore(data, store);
+    }
+    else if (options.useBuffer)
+    {
+      std::vector< char > buffer;
+      kostyukov::readBuffer(std::cin, buffer);
+      parse(buffer.data(), buffer.data() + buffer.size(), data, options);
+      fillStore(data, store);
+    }
+    else
+    {
+      readStream(std::cin.rdbuf(), store, options.resyncMode);
+    }
+    store.sort();
+    if (options.useBulkOutput)
+    {
+      kostyukov::BulkWriter writer(stdout);
+      for (size_t i = 0; i < store.size(); ++i)
+      {
+        writer.write(store[i]);
+      }
+      return writer.flush();
+    }
+    std::cout << store;
+    return static_cast< bool >(std::cout.flush());
+  }
+
+  int reportOutputError()
+  {
+    std::cerr << "<OUTPUT ERROR>\n";
+    return 1;
+  }
+
+  bool isSameRecord(const DataStruct& lhs, const DataStruct& rhs)
+  {
+    return lhs.key1 == rhs.key1 && lhs.key2 == rhs.key2 && lhs.key3 == rhs.key3;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  Options options;
+  if (!parseOptions(argc, argv, options))
+  {
+    std::cerr << "<INVALID PARAMETERS>\n";
+    return 1;
+  }
+  if (options.useBenchmark)
+  {
+    kostyukov::benchmarkHexUll(std::cout);
+    return 0;
+  }
+  if (options.path || options.useStore)
+  {
+    bool isPrinted = false;
+    try
+    {
+      isPrinted = options.useStore ? processStore(options) : processMappedFile(options);
+    }
+    catch (const std::exception& e)
+    {
+      std::cerr << e.what() << '\n';
+      return 1;
+    }
+    return isPrinted ? 0 : reportOutputError();
+  }
+  if (options.useSelector)
+  {
+    kostyukov::RecordSelector selector(options.topCount, options.minKey1, options.maxKey1);
+    readStream(std::cin.rdbuf(), selector, options.resyncMode);
+    return print(selector.release(), options) ? 0 : reportOutputError();
+  }
   std::vector< DataStruct > data;
-  while (!std::cin.eof())
+  if (!options.useBuffer)
+  {
+    readStream(std::cin.rdbuf(), data, options.resyncMode);
+  }
+  else
   {
-    std::copy(DataStructInputIt(std::cin), DataStructInputIt(), std::back_inserter(data));
-    if (std::cin.fail())
+    std::vector< char > buffer;
+    kostyukov::readBuffer(std::cin, buffer);
+    try
+    {
+      parse(buffer.data(), buffer.data() + buffer.size(), data, options);
+    }
+    catch (const std::exception& e)
+    {
+      std::cerr << e.what() << '\n';
+      return 1;
+    }
+    if (options.check)
     {
-      std::cin.clear();
-      std::cin.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
+      std::istringstream reference(std::string(buffer.data(), buffer.size()));
+      std::vector< DataStruct > referenceData;
+      readStream(reference.rdbuf(), referenceData, options.resyncMode);
+      if (!std::equal(data.begin(), data.end(), referenceData.begin(), referenceData.end(), isSameRecord))
+      {
+        std::cerr << "<PARSERS MISMATCH>\n";
+        return 1;
+      }
     }
   }
-  std::sort(data.begin(), data.end());
-  std::copy(std::begin(data), std::end(data), DataStructOutputIt(std::cout, "\n"));
-  return 0;
+  return sortAndPrint(data, options) ? 0 : reportOutputError();
 }
@@ -0,0 +1,100 @@
+#include "mappedFile.hpp"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <cstdio>
+#include <new>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+kostyukov::MappedFile::MappedFile(const char* path):
+  data_(nullptr),
+  size_(0)
+{
+  std::FILE* file = std::fopen(path, "rb");
+  if (!file)
+  {
+    throw std::runtime_error("<INVALID FILE>");
+  }
+  long size = -1;
+  if (std::fseek(file, 0, SEEK_END) == 0)
+  {
+    size = std::ftell(file);
+  }
+  if (size < 0 || std::fseek(file, 0, SEEK_SET) != 0)
+  {
+    std::fclose(file);
+    throw std::runtime_error("<INVALID FILE>");
+  }
+  size_ = static_cast< size_t >(size);
+  if (size_ != 0)
+  {
+    data_ = ::operator new(size_, std::nothrow);
+    if (!data_ || std::fread(data_, 1, size_, file) != size_)
+    {
+      ::operator delete(data_);
+      std::fclose(file);
+      throw std::runtime_error("<FILE READING FAILED>");
+    }
+  }
+  std::fclose(file);
+}
+
+kostyukov::MappedFile::~MappedFile()
+{
+  ::operator delete(data_);
+}
+#else
+kostyukov::MappedFile::MappedFile(const char* path):
+  data_(nullptr),
+  size_(0)
+{
+  int fd = ::open(path, O_RDONLY);
+  if (fd == -1)
+  {
+    throw std::runtime_error("<INVALID FILE>");
+  }
+  struct stat info;
+  if (::fstat(fd, &info) == -1)
+  {
+    ::close(fd);
+    throw std::runtime_error("<INVALID FILE>");
+  }
+  size_ = static_cast< size_t >(info.st_size);
+  if (size_ != 0)
+  {
+    data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data_ == MAP_FAILED)
+    {
+      ::close(fd);
+      throw std::runtime_error("<FILE MAPPING FAILED>");
+    }
+    ::madvise(data_, size_, MADV_SEQUENTIAL);
+  }
+  ::close(fd);
+}
+
+kostyukov::MappedFile::~MappedFile()
+{
+  if (size_ != 0)
+  {
+    ::munmap(data_, size_);
+  }
+}
+#endif
+
+const char* kostyukov::MappedFile::begin() const noexcept
+{
+  return static_cast< const char* >(data_);
+}
+
+const char* kostyukov::MappedFile::end() const noexcept
+{
+  return begin() + size_;
+}
@@ -0,0 +1,23 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+#include <cstddef>
+
+namespace kostyukov
+{
+  class MappedFile
+  {
+    public:
+      explicit MappedFile(const char* path);
+      ~MappedFile();
+      MappedFile(const MappedFile&) = delete;
+      MappedFile(MappedFile&&) = delete;
+      MappedFile& operator=(const MappedFile&) = delete;
+      MappedFile& operator=(MappedFile&&) = delete;
+      const char* begin() const noexcept;
+      const char* end() const noexcept;
+    private:
+      void* data_;
+      size_t size_;
+  };
+}
+#endif
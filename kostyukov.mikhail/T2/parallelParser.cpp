@@ -0,0 +1,146 @@
+#include "parallelParser.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+namespace
+{
+  struct Attempt
+  {
+    const char* pos;
+    size_t parsedBefore;
+  };
+
+  template< class T >
+  struct Chunk
+  {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    const char* stop = nullptr;
+    std::vector< Attempt > attempts;
+    std::vector< T > data;
+  };
+
+  const char* attemptParse(const char* pos, const char* end, std::vector< kostyukov::DataStruct >& data,
+    kostyukov::ResyncMode mode)
+  {
+    kostyukov::DataStruct temp;
+    bool isParsed = false;
+    pos = kostyukov::parseDataStruct(pos, end, temp, isParsed);
+    if (isParsed)
+    {
+      data.push_back(std::move(temp));
+      return pos;
+    }
+    return kostyukov::resync(pos, end, mode);
+  }
+
+  const char* attemptParse(const char* pos, const char* end, std::vector< kostyukov::DataStructRef >& data,
+    kostyukov::ResyncMode mode)
+  {
+    kostyukov::DataStructRef temp;
+    bool isParsed = false;
+    pos = kostyukov::parseDataStruct(pos, end, temp, isParsed);
+    if (isParsed)
+    {
+      data.push_back(temp);
+      return pos;
+    }
+    return kostyukov::resync(pos, end, mode);
+  }
+
+  template< class T >
+  void parseChunk(const char* end, kostyukov::ResyncMode mode, Chunk< T >& chunk)
+  {
+    const char* pos = chunk.begin;
+    while (pos < chunk.end)
+    {
+      chunk.attempts.push_back({ pos, chunk.data.size() });
+      pos = attemptParse(pos, end, chunk.data, mode);
+    }
+    chunk.stop = pos;
+  }
+
+  bool isAttemptBefore(const Attempt& attempt, const char* pos)
+  {
+    return attempt.pos < pos;
+  }
+
+  template< class T >
+  void parseParallel(const char* begin, const char* end, std::vector< T >& data, size_t threadCount,
+    kostyukov::ResyncMode mode)
+  {
+    const size_t size = static_cast< size_t >(end - begin);
+    threadCount = std::max< size_t >(1, std::min(threadCount, size));
+    std::vector< Chunk< T > > chunks(threadCount);
+    const char* chunkBegin = begin;
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+      const char* chunkEnd = end;
+      if (i + 1 != threadCount)
+      {
+        chunkEnd = kostyukov::skipLine(std::max(chunkBegin, begin + size / threadCount * (i + 1)), end);
+      }
+      chunks[i].begin = chunkBegin;
+      chunks[i].end = chunkEnd;
+      chunkBegin = chunkEnd;
+    }
+    std::vector< std::thread > workers;
+    workers.reserve(threadCount - 1);
+    try
+    {
+      for (size_t i = 1; i < threadCount; ++i)
+      {
+        workers.emplace_back(parseChunk< T >, end, mode, std::ref(chunks[i]));
+      }
+    }
+    catch (const std::system_error&)
+    {
+      for (auto&& worker: workers)
+      {
+        worker.join();
+      }
+      throw std::runtime_error("<THREAD CREATION FAILED>");
+    }
+    parseChunk(end, mode, chunks[0]);
+    for (auto&& worker: workers)
+    {
+      worker.join();
+    }
+    data.insert(data.end(), std::make_move_iterator(chunks[0].data.begin()), std::make_move_iterator(chunks[0].data.end()));
+    const char* pos = chunks[0].stop;
+    for (size_t i = 1; i < threadCount; ++i)
+    {
+      Chunk< T >& chunk = chunks[i];
+      while (pos < chunk.end)
+      {
+        auto found = std::lower_bound(chunk.attempts.begin(), chunk.attempts.end(), pos, isAttemptBefore);
+        if (found != chunk.attempts.end() && found->pos == pos)
+        {
+          auto first = chunk.data.begin() + found->parsedBefore;
+          data.insert(data.end(), std::make_move_iterator(first), std::make_move_iterator(chunk.data.end()));
+          pos = chunk.stop;
+          break;
+        }
+        pos = attemptParse(pos, end, data, mode);
+      }
+    }
+  }
+}
+
+void kostyukov::parseBufferParallel(const char* begin, const char* end, std::vector< DataStruct >& data,
+  size_t threadCount, ResyncMode mode)
+{
+  parseParallel(begin, end, data, threadCount, mode);
+}
+
+void kostyukov::parseBufferParallel(const char* begin, const char* end, std::vector< DataStructRef >& data,
+  size_t threadCount, ResyncMode mode)
+{
+  parseParallel(begin, end, data, threadCount, mode);
+}
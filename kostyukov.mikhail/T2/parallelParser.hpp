@@ -0,0 +1,15 @@
+#ifndef PARALLEL_PARSER_HPP
+#define PARALLEL_PARSER_HPP
+#include <cstddef>
+#include <vector>
+
+#include "bufferParser.hpp"
+
+namespace kostyukov
+{
+  void parseBufferParallel(const char* begin, const char* end, std::vector< DataStruct >& data, size_t threadCount,
+    ResyncMode mode);
+  void parseBufferParallel(const char* begin, const char* end, std::vector< DataStructRef >& data, size_t threadCount,
+    ResyncMode mode);
+}
+#endif
@@ -0,0 +1,101 @@
+#include "radixSort.hpp"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace
+{
+  struct SortKey
+  {
+    unsigned long long key1;
+    unsigned long long key2;
+    unsigned long long key3Size;
+    size_t index;
+  };
+
+  const size_t BYTE_BITS = 8;
+  const size_t BUCKET_COUNT = 1 << BYTE_BITS;
+  const size_t BYTES_PER_FIELD = sizeof(unsigned long long);
+  const size_t FIELD_COUNT = 3;
+  const size_t PASS_COUNT = BYTES_PER_FIELD * FIELD_COUNT;
+
+  using Histogram = std::array< size_t, BUCKET_COUNT >;
+
+  size_t key3Size(const kostyukov::DataStruct& value)
+  {
+    return value.key3.size();
+  }
+
+  size_t key3Size(const kostyukov::DataStructRef& value)
+  {
+    return value.key3Size;
+  }
+
+  size_t digit(const SortKey& key, size_t pass)
+  {
+    const unsigned long long fields[FIELD_COUNT] = { key.key3Size, key.key2, key.key1 };
+    const unsigned long long field = fields[pass / BYTES_PER_FIELD];
+    return static_cast< size_t >(field >> (pass % BYTES_PER_FIELD * BYTE_BITS)) & (BUCKET_COUNT - 1);
+  }
+
+  template< class T >
+  void sortByKeys(std::vector< T >& data)
+  {
+    const size_t size = data.size();
+    std::vector< SortKey > keys(size);
+    std::vector< Histogram > histograms(PASS_COUNT, Histogram{});
+    for (size_t i = 0; i < size; ++i)
+    {
+      keys[i] = { data[i].key1, data[i].key2, key3Size(data[i]), i };
+      for (size_t pass = 0; pass < PASS_COUNT; ++pass)
+      {
+        ++histograms[pass][digit(keys[i], pass)];
+      }
+    }
+    std::vector< SortKey > buffer(size);
+    for (size_t pass = 0; pass < PASS_COUNT; ++pass)
+    {
+      Histogram& counts = histograms[pass];
+      if (counts[digit(keys[0], pass)] == size)
+      {
+        continue;
+      }
+      size_t offset = 0;
+      for (size_t& count: counts)
+      {
+        size_t bucketSize = count;
+        count = offset;
+        offset += bucketSize;
+      }
+      for (const SortKey& key: keys)
+      {
+        buffer[counts[digit(key, pass)]++] = key;
+      }
+      keys.swap(buffer);
+    }
+    std::vector< T > sorted;
+    sorted.reserve(size);
+    for (const SortKey& key: keys)
+    {
+      sorted.push_back(std::move(data[key.index]));
+    }
+    data.swap(sorted);
+  }
+}
+
+void kostyukov::radixSort(std::vector< DataStruct >& data)
+{
+  if (!data.empty())
+  {
+    sortByKeys(data);
+  }
+}
+
+void kostyukov::radixSort(std::vector< DataStructRef >& data)
+{
+  if (!data.empty())
+  {
+    sortByKeys(data);
+  }
+}
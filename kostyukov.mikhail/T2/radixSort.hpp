@@ -0,0 +1,13 @@
+#ifndef RADIX_SORT_HPP
+#define RADIX_SORT_HPP
+#include <vector>
+
+#include "bufferParser.hpp"
+#include "dataStruct.hpp"
+
+namespace kostyukov
+{
+  void radixSort(std::vector< DataStruct >& data);
+  void radixSort(std::vector< DataStructRef >& data);
+}
+#endif
@@ -0,0 +1,47 @@
+#include "recordSelector.hpp"
+
+#include <algorithm>
+#include <utility>
+
+kostyukov::RecordSelector::RecordSelector(size_t limit, unsigned long long minKey1, unsigned long long maxKey1):
+  limit_(limit),
+  minKey1_(minKey1),
+  maxKey1_(maxKey1),
+  records_()
+{}
+
+void kostyukov::RecordSelector::push_back(const DataStruct& value)
+{
+  if (value.key1 < minKey1_ || value.key1 > maxKey1_ || limit_ == 0)
+  {
+    return;
+  }
+  if (limit_ == UNLIMITED_RECORDS)
+  {
+    records_.push_back(value);
+  }
+  else if (records_.size() < limit_)
+  {
+    records_.push_back(value);
+    std::push_heap(records_.begin(), records_.end());
+  }
+  else if (value < records_.front())
+  {
+    std::pop_heap(records_.begin(), records_.end());
+    records_.back() = value;
+    std::push_heap(records_.begin(), records_.end());
+  }
+}
+
+std::vector< kostyukov::DataStruct > kostyukov::RecordSelector::release()
+{
+  if (limit_ == UNLIMITED_RECORDS)
+  {
+    std::sort(records_.begin(), records_.end());
+  }
+  else
+  {
+    std::sort_heap(records_.begin(), records_.end());
+  }
+  return std::move(records_);
+}
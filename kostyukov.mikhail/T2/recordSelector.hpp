@@ -0,0 +1,27 @@
+#ifndef RECORD_SELECTOR_HPP
+#define RECORD_SELECTOR_HPP
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "dataStruct.hpp"
+
+namespace kostyukov
+{
+  const size_t UNLIMITED_RECORDS = std::numeric_limits< size_t >::max();
+
+  class RecordSelector
+  {
+    public:
+      using value_type = DataStruct;
+      RecordSelector(size_t limit, unsigned long long minKey1, unsigned long long maxKey1);
+      void push_back(const DataStruct& value);
+      std::vector< DataStruct > release();
+    private:
+      size_t limit_;
+      unsigned long long minKey1_;
+      unsigned long long maxKey1_;
+      std::vector< DataStruct > records_;
+  };
+}
+#endif
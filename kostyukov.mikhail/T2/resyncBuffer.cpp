@@ -0,0 +1,56 @@
+#include "resyncBuffer.hpp"
+
+#include <cstring>
+
+const char* kostyukov::findResyncPoint(const char* pos, const char* end, ResyncMode mode) noexcept
+{
+  const size_t size = static_cast< size_t >(end - pos);
+  const char* newline = static_cast< const char* >(std::memchr(pos, '\n', size));
+  if (mode == ResyncMode::RECORD)
+  {
+    const char* record = static_cast< const char* >(std::memchr(pos, '(', newline ? newline - pos : size));
+    if (record)
+    {
+      return record;
+    }
+  }
+  return newline ? newline + 1 : nullptr;
+}
+
+const char* kostyukov::resync(const char* pos, const char* end, ResyncMode mode) noexcept
+{
+  const char* found = findResyncPoint(pos, end, mode);
+  return found ? found : end;
+}
+
+kostyukov::ResyncBuffer::ResyncBuffer(std::streambuf* source, size_t capacity):
+  source_(source),
+  buffer_(capacity)
+{
+  setg(buffer_.data(), buffer_.data(), buffer_.data());
+}
+
+bool kostyukov::ResyncBuffer::skip(ResyncMode mode)
+{
+  while (!traits_type::eq_int_type(sgetc(), traits_type::eof()))
+  {
+    const char* found = findResyncPoint(gptr(), egptr(), mode);
+    if (found)
+    {
+      gbump(static_cast< int >(found - gptr()));
+      return true;
+    }
+    setg(eback(), egptr(), egptr());
+  }
+  return false;
+}
+
+kostyukov::ResyncBuffer::int_type kostyukov::ResyncBuffer::underflow()
+{
+  if (gptr() == egptr())
+  {
+    std::streamsize count = source_->sgetn(buffer_.data(), static_cast< std::streamsize >(buffer_.size()));
+    setg(buffer_.data(), buffer_.data(), buffer_.data() + count);
+  }
+  return gptr() == egptr() ? traits_type::eof() : traits_type::to_int_type(*gptr());
+}
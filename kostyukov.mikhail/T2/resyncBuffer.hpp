@@ -0,0 +1,31 @@
+#ifndef RESYNC_BUFFER_HPP
+#define RESYNC_BUFFER_HPP
+#include <cstddef>
+#include <streambuf>
+#include <vector>
+
+namespace kostyukov
+{
+  enum class ResyncMode
+  {
+    LINE,
+    RECORD
+  };
+  const char* findResyncPoint(const char* pos, const char* end, ResyncMode mode) noexcept;
+  const char* resync(const char* pos, const char* end, ResyncMode mode) noexcept;
+
+  class ResyncBuffer: public std::streambuf
+  {
+    public:
+      explicit ResyncBuffer(std::streambuf* source, size_t capacity = 1 << 20);
+      ResyncBuffer(const ResyncBuffer&) = delete;
+      ResyncBuffer& operator=(const ResyncBuffer&) = delete;
+      bool skip(ResyncMode mode);
+    protected:
+      int_type underflow() override;
+    private:
+      std::streambuf* source_;
+      std::vector< char > buffer_;
+  };
+}
+#endif
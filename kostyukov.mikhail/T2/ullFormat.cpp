@@ -0,0 +1,93 @@
+#include "ullFormat.hpp"
+
+#include <cstring>
+#include <limits>
+
+namespace
+{
+  const size_t BYTE_BITS = 8;
+  const size_t NIBBLE_BITS = 4;
+  const size_t PREFIX_LENGTH = 2;
+  const size_t ULL_BIT_COUNT = std::numeric_limits< unsigned long long >::digits;
+  const size_t ULL_NIBBLE_COUNT = ULL_BIT_COUNT / NIBBLE_BITS;
+  const size_t BYTE_NIBBLES = BYTE_BITS / NIBBLE_BITS;
+
+  struct BinByteTable
+  {
+    char digits[256][BYTE_BITS];
+    constexpr BinByteTable():
+      digits()
+    {
+      for (size_t byte = 0; byte < 256; ++byte)
+      {
+        for (size_t bit = 0; bit < BYTE_BITS; ++bit)
+        {
+          digits[byte][bit] = ((byte >> (BYTE_BITS - 1 - bit)) & 1) ? '1' : '0';
+        }
+      }
+    }
+  };
+
+  constexpr char HEX_DIGITS[] = "0123456789ABCDEF";
+
+  struct HexByteTable
+  {
+    char digits[256][BYTE_NIBBLES];
+    constexpr HexByteTable():
+      digits()
+    {
+      for (size_t byte = 0; byte < 256; ++byte)
+      {
+        digits[byte][0] = HEX_DIGITS[byte >> NIBBLE_BITS];
+        digits[byte][1] = HEX_DIGITS[byte & 0xF];
+      }
+    }
+  };
+
+  constexpr BinByteTable BIN_BYTE_TABLE{};
+  constexpr HexByteTable HEX_BYTE_TABLE{};
+}
+
+size_t kostyukov::formatBinUll(unsigned long long value, char* dest) noexcept
+{
+  if (value <= 1)
+  {
+    const char* literal = value == 0 ? "0b0" : "0b01";
+    size_t length = value == 0 ? 3 : 4;
+    std::memcpy(dest, literal, length);
+    return length;
+  }
+  char buffer[PREFIX_LENGTH + ULL_BIT_COUNT];
+  char* digits = buffer + PREFIX_LENGTH;
+  for (size_t i = 0; i < ULL_BIT_COUNT / BYTE_BITS; ++i)
+  {
+    size_t shift = ULL_BIT_COUNT - BYTE_BITS * (i + 1);
+    std::memcpy(digits + i * BYTE_BITS, BIN_BYTE_TABLE.digits[(value >> shift) & 0xFF], BYTE_BITS);
+  }
+  size_t leadingZeros = static_cast< size_t >(__builtin_clzll(value));
+  size_t length = PREFIX_LENGTH + ULL_BIT_COUNT - leadingZeros;
+  dest[0] = '0';
+  dest[1] = 'b';
+  std::memcpy(dest + PREFIX_LENGTH, digits + leadingZeros, length - PREFIX_LENGTH);
+  return length;
+}
+
+size_t kostyukov::formatHexUll(unsigned long long value, char* dest) noexcept
+{
+  char digits[ULL_NIBBLE_COUNT];
+  for (size_t i = 0; i < ULL_BIT_COUNT / BYTE_BITS; ++i)
+  {
+    size_t shift = ULL_BIT_COUNT - BYTE_BITS * (i + 1);
+    std::memcpy(digits + i * BYTE_NIBBLES, HEX_BYTE_TABLE.digits[(value >> shift) & 0xFF], BYTE_NIBBLES);
+  }
+  size_t leadingZeros = ULL_NIBBLE_COUNT - 1;
+  if (value != 0)
+  {
+    leadingZeros = static_cast< size_t >(__builtin_clzll(value)) / NIBBLE_BITS;
+  }
+  size_t digitCount = ULL_NIBBLE_COUNT - leadingZeros;
+  dest[0] = '0';
+  dest[1] = 'x';
+  std::memcpy(dest + PREFIX_LENGTH, digits + leadingZeros, digitCount);
+  return PREFIX_LENGTH + digitCount;
+}
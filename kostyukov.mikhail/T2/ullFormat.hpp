@@ -0,0 +1,12 @@
+#ifndef ULL_FORMAT_HPP
+#define ULL_FORMAT_HPP
+#include <cstddef>
+
+namespace kostyukov
+{
+  const size_t BIN_ULL_MAX_LENGTH = 66;
+  const size_t HEX_ULL_MAX_LENGTH = 18;
+  size_t formatBinUll(unsigned long long value, char* dest) noexcept;
+  size_t formatHexUll(unsigned long long value, char* dest) noexcept;
+}
+#endif
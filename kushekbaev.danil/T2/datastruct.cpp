@@ -1,5 +1,8 @@
 #include "datastruct.hpp"
 #include <iostream>
+#include <algorithm>
+#include <climits>
+#include <unordered_map>
 
 bool kushekbaev::DataStruct::operator<(const DataStruct& other) const
 {
@@ -153,3 +156,92 @@ std::ostream& kushekbaev::operator<<(std::ostream& out, const DataStruct& obj)
   out << ":)";
   return out;
 }
+
+void kushekbaev::countingSort(std::vector< DataStruct >& data)
+{
+  const size_t maxGroups = data.size() / 64 + 1;
+  const size_t maxLength = 1 << 16;
+  std::unordered_map< unsigned long long, size_t > groupOf;
+  std::vector< size_t > leaders;
+  std::vector< size_t > groups(data.size());
+  size_t longest = 0;
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    longest = std::max(longest, data[i].key3.size());
+    auto found = groupOf.find(data[i].key1);
+    if (found == groupOf.end())
+    {
+      if (leaders.size() == maxGroups)
+      {
+        std::stable_sort(data.begin(), data.end());
+        return;
+      }
+      found = groupOf.insert({ data[i].key1, leaders.size() }).first;
+      leaders.push_back(i);
+    }
+    groups[i] = found->second;
+  }
+  if (longest > maxLength)
+  {
+    std::stable_sort(data.begin(), data.end());
+    return;
+  }
+
+  std::vector< size_t > byLeader(leaders.size());
+  for (size_t i = 0; i < byLeader.size(); ++i)
+  {
+    byLeader[i] = i;
+  }
+  std::sort(byLeader.begin(), byLeader.end(), [&](size_t lhs, size_t rhs)
+  {
+    return data[leaders[lhs]] < data[leaders[rhs]];
+  });
+  std::vector< size_t > rank(leaders.size());
+  for (size_t i = 0; i < byLeader.size(); ++i)
+  {
+    rank[byLeader[i]] = i;
+  }
+
+  std::vector< size_t > lengths(data.size());
+  std::vector< size_t > chars(data.size());
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    lengths[i] = data[i].key3.size();
+    chars[i] = static_cast< size_t >(data[i].key2 - CHAR_MIN);
+    groups[i] = rank[groups[i]];
+  }
+  std::vector< size_t > order(data.size());
+  std::vector< size_t > next(data.size());
+  for (size_t i = 0; i < order.size(); ++i)
+  {
+    order[i] = i;
+  }
+  auto pass = [&order, &next](size_t buckets, const std::vector< size_t >& keys)
+  {
+    std::vector< size_t > count(buckets + 1, 0);
+    for (size_t i: order)
+    {
+      ++count[keys[i] + 1];
+    }
+    for (size_t b = 0; b < buckets; ++b)
+    {
+      count[b + 1] += count[b];
+    }
+    for (size_t i: order)
+    {
+      next[count[keys[i]]++] = i;
+    }
+    order.swap(next);
+  };
+  pass(longest + 1, lengths);
+  pass(UCHAR_MAX + 1, chars);
+  pass(leaders.size(), groups);
+
+  std::vector< DataStruct > result;
+  result.reserve(data.size());
+  for (size_t i: order)
+  {
+    result.push_back(std::move(data[i]));
+  }
+  data.swap(result);
+}
@@ -2,6 +2,7 @@
 #define DATASTRUCT_HPP
 
 #include <string>
+#include <vector>
 #include <ios>
 
 namespace kushekbaev
@@ -46,6 +47,7 @@ namespace kushekbaev
   std::istream& operator>>(std::istream& in, DataStruct& obj);
   std::ostream& operator<<(std::ostream& out, const ULLBinaryO&& obj);
   std::ostream& operator<<(std::ostream& out, const DataStruct& obj);
+  void countingSort(std::vector< DataStruct >& data);
 }
 
 #endif
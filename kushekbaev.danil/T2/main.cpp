@@ -3,11 +3,27 @@
 #include <algorithm>
 #include <iostream>
 #include <limits>
+#include <cstring>
 #include "datastruct.hpp"
 
-int main()
+int main(int argc, char* argv[])
 {
   using namespace kushekbaev;
+  if (argc > 2)
+  {
+    std::cerr << "Too many arguments\n";
+    return 1;
+  }
+  bool isCounting = false;
+  if (argc == 2)
+  {
+    if (std::strcmp(argv[1], "--counting") != 0)
+    {
+      std::cerr << "Unknown option: " << argv[1] << "\n";
+      return 1;
+    }
+    isCounting = true;
+  }
   std::vector< DataStruct > data;
   while (!std::cin.eof())
   {
@@ -24,6 +40,13 @@ int main()
     }
   }
 
-  std::sort(data.begin(), data.end());
+  if (isCounting)
+  {
+    countingSort(data);
+  }
+  else
+  {
+    std::sort(data.begin(), data.end());
+  }
   std::copy(std::begin(data), std::end(data), std::ostream_iterator< DataStruct >(std::cout, "\n"));
 }
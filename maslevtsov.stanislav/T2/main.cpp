@@ -3,16 +3,37 @@
 #include <iterator>
 #include <limits>
 #include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
 #include "data_struct.hpp"
 #include "compare.hpp"
+#include "parallel_sort.hpp"
 
-int main()
+int main(int argc, char** argv)
 {
   using namespace maslevtsov;
   using data_struct_in_it = std::istream_iterator< DataStruct >;
   using data_struct_out_it = std::ostream_iterator< DataStruct >;
   using streamsize_lim = std::numeric_limits< std::streamsize >;
 
+  std::size_t thread_count = 1;
+  if (argc == 3 && std::strcmp(argv[1], "--threads") == 0) {
+    char* last = nullptr;
+    thread_count = std::strtoul(argv[2], &last, 10);
+    if (!std::isdigit(static_cast< unsigned char >(*argv[2])) || *last != '\0') {
+      std::cerr << "<INVALID PARAMETERS>\n";
+      return 1;
+    }
+    if (thread_count == 0) {
+      thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+  } else if (argc != 1) {
+    std::cerr << "<INVALID PARAMETERS NUMBER>\n";
+    return 1;
+  }
+
   std::vector< DataStruct > data;
 
   while (!std::cin.eof()) {
@@ -23,7 +44,7 @@ int main()
     }
   }
 
-  std::sort(data.begin(), data.end(), compare);
+  parallel_sort(data.begin(), data.end(), compare, thread_count);
 
   std::copy(std::begin(data), std::end(data), data_struct_out_it(std::cout, "\n"));
 }
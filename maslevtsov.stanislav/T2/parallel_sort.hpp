@@ -0,0 +1,71 @@
+#ifndef PARALLEL_SORT_HPP
+#define PARALLEL_SORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace maslevtsov {
+  template< class RandomIt, class Compare >
+  void parallel_sort(RandomIt first, RandomIt last, Compare comp, std::size_t thread_count);
+
+  namespace detail {
+    constexpr std::size_t min_partition_size = 1 << 12;
+
+    template< class Function >
+    void run_parallel(std::size_t task_count, Function task)
+    {
+      std::vector< std::thread > workers;
+      workers.reserve(task_count);
+      for (std::size_t i = 1; i < task_count; ++i) {
+        workers.emplace_back(task, i);
+      }
+      task(0);
+      for (auto&& worker: workers) {
+        worker.join();
+      }
+    }
+  }
+}
+
+template< class RandomIt, class Compare >
+void maslevtsov::parallel_sort(RandomIt first, RandomIt last, Compare comp, std::size_t thread_count)
+{
+  std::size_t size = static_cast< std::size_t >(std::distance(first, last));
+  std::size_t core_count = std::max(1u, std::thread::hardware_concurrency());
+  std::size_t part_count = std::min({thread_count, core_count, size / detail::min_partition_size});
+  if (part_count < 2) {
+    std::sort(first, last, comp);
+    return;
+  }
+  std::vector< RandomIt > bounds;
+  bounds.reserve(part_count + 1);
+  for (std::size_t i = 0; i < part_count; ++i) {
+    bounds.push_back(first + size * i / part_count);
+  }
+  bounds.push_back(last);
+  detail::run_parallel(part_count, [&bounds, comp](std::size_t i)
+  {
+    std::sort(bounds[i], bounds[i + 1], comp);
+  });
+  while (bounds.size() > 2) {
+    std::size_t merge_count = (bounds.size() - 1) / 2;
+    detail::run_parallel(merge_count, [&bounds, comp](std::size_t i)
+    {
+      std::inplace_merge(bounds[2 * i], bounds[2 * i + 1], bounds[2 * i + 2], comp);
+    });
+    std::vector< RandomIt > merged_bounds;
+    merged_bounds.reserve(bounds.size() / 2 + 1);
+    for (std::size_t i = 0; i < bounds.size(); i += 2) {
+      merged_bounds.push_back(bounds[i]);
+    }
+    if (merged_bounds.back() != last) {
+      merged_bounds.push_back(last);
+    }
+    bounds.swap(merged_bounds);
+  }
+}
+
+#endif
@@ -3,6 +3,13 @@
 #include <cmath>
 #include "streamGuard.hpp"
 
+namespace
+{
+  using Traits = std::char_traits< char >;
+
+  const size_t CHAR_LIT_SIZE = 3;
+}
+
 std::ostream & maslov::operator<<(std::ostream & out, const DataStruct & data)
 {
   std::ostream::sentry sentry(out);
@@ -13,8 +20,10 @@ std::ostream & maslov::operator<<(std::ostream & out, const DataStruct & data)
   StreamGuard guard(out);
   out << "(";
   out << ":key1 " << DoubleSciIO{const_cast< double & >(data.key1)};
-  out << ":key2 '" << data.key2;
-  out << "':key3 \"" << data.key3;
+  const char key2[CHAR_LIT_SIZE] = {'\'', data.key2, '\''};
+  out << ":key2 ";
+  out.write(key2, CHAR_LIT_SIZE);
+  out << ":key3 \"" << data.key3;
   out << "\":)";
   return out;
 }
@@ -77,20 +86,24 @@ std::istream & maslov::operator>>(std::istream & in, CharLitIO && dest)
   {
     return in;
   }
-  if (!(in >> DelimiterIO{'\''}))
-  {
-    return in;
-  }
-  StreamGuard guard(in);
-  in >> std::noskipws;
-  char c;
-  if(!(in >> c))
+  std::streambuf & buf = *in.rdbuf();
+  char literal[CHAR_LIT_SIZE] = {};
+  for (size_t i = 0; i < CHAR_LIT_SIZE; ++i)
   {
-    in.setstate(std::ios::failbit);
-    return in;
+    int c = buf.sbumpc();
+    if (Traits::eq_int_type(c, Traits::eof()))
+    {
+      in.setstate(std::ios::eofbit | std::ios::failbit);
+      return in;
+    }
+    literal[i] = Traits::to_char_type(c);
+    if ((i != 1) && (literal[i] != '\''))
+    {
+      in.setstate(std::ios::failbit);
+      return in;
+    }
   }
-  dest.ref = c;
-  in >> DelimiterIO{'\''};
+  dest.ref = literal[1];
   return in;
 }
 
@@ -3,6 +3,33 @@
 #include <cctype>
 #include "guard.h"
 
+namespace
+{
+  using Traits = std::char_traits< char >;
+
+  const size_t CHAR_TOKEN_SIZE = 4;
+  const size_t CHAR_POSITION = 1;
+
+  bool readChar(std::streambuf& buf, bool skipSpaces, char& c)
+  {
+    if (skipSpaces)
+    {
+      int next = buf.sgetc();
+      while (!Traits::eq_int_type(next, Traits::eof()) && std::isspace(next))
+      {
+        next = buf.snextc();
+      }
+    }
+    int got = buf.sbumpc();
+    if (Traits::eq_int_type(got, Traits::eof()))
+    {
+      return false;
+    }
+    c = Traits::to_char_type(got);
+    return true;
+  }
+}
+
 std::istream& mezentsev::operator>>(std::istream& input, DelimiterIO&& dest)
 {
   std::istream::sentry sentry(input);
@@ -35,7 +62,25 @@ std::istream& mezentsev::operator>>(std::istream& input, CharIO&& dest)
   {
     return input;
   }
-  return input >> DelimiterIO{ '\'' } >> dest.def >> DelimitersIO{ "\':" };
+  const char expected[CHAR_TOKEN_SIZE + 1] = "'?':";
+  std::streambuf& buf = *input.rdbuf();
+  bool skipSpaces = (input.flags() & std::ios::skipws) != 0;
+  char token[CHAR_TOKEN_SIZE] = {};
+  for (size_t i = 0; i < CHAR_TOKEN_SIZE; i++)
+  {
+    if (!readChar(buf, skipSpaces, token[i]))
+    {
+      input.setstate(std::ios::eofbit | std::ios::failbit);
+      return input;
+    }
+    if (i != CHAR_POSITION && token[i] != expected[i])
+    {
+      input.setstate(std::ios::failbit);
+      return input;
+    }
+  }
+  dest.def = token[CHAR_POSITION];
+  return input;
 }
 
 std::istream& mezentsev::operator>>(std::istream& input, StringIO&& dest)
@@ -109,7 +154,8 @@ std::istream& mezentsev::operator>>(std::istream& in, DataStruct& dest)
 
 std::ostream& mezentsev::operator<<(std::ostream& output, const CharIO&& dest)
 {
-  return output << "\'" << dest.def << "\'";
+  const char literal[] = { '\'', dest.def, '\'' };
+  return output.write(literal, sizeof(literal));
 }
 
 std::ostream& mezentsev::operator<<(std::ostream &output, const StringIO&& dest)
@@ -0,0 +1,105 @@
+#include "counting_sort.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+  const size_t char_count = UCHAR_MAX + 1;
+  const size_t max_minor_buckets = 1 << 16;
+  const size_t min_group_size = 64;
+
+  struct sort_entry
+  {
+    size_t index;
+    size_t minor;
+    size_t major;
+  };
+
+  void stable_count(std::vector< sort_entry > &entries, std::vector< sort_entry > &buffer, size_t buckets, bool by_major)
+  {
+    std::vector< size_t > positions(buckets + 1, 0);
+    for (const sort_entry &entry : entries)
+    {
+      positions[(by_major ? entry.major : entry.minor) + 1]++;
+    }
+    for (size_t i = 0; i < buckets; i++)
+    {
+      positions[i + 1] += positions[i];
+    }
+    for (const sort_entry &entry : entries)
+    {
+      buffer[positions[by_major ? entry.major : entry.minor]++] = entry;
+    }
+    entries.swap(buffer);
+  }
+}
+
+void nehvedovich::countingSort(std::vector< DataStruct > &data)
+{
+  size_t max_length = 0;
+  for (const DataStruct &value : data)
+  {
+    max_length = std::max(max_length, value.key3.size());
+  }
+  const size_t minor_buckets = char_count * (max_length + 1);
+  if (minor_buckets > max_minor_buckets)
+  {
+    std::stable_sort(data.begin(), data.end());
+    return;
+  }
+
+  const size_t max_groups = data.size() / min_group_size + 1;
+  std::unordered_map< unsigned long long, size_t > group_ids;
+  std::vector< size_t > first_of_group;
+  std::vector< sort_entry > entries(data.size());
+  for (size_t i = 0; i < data.size(); i++)
+  {
+    auto group = group_ids.find(data[i].key1);
+    if (group == group_ids.end())
+    {
+      if (first_of_group.size() == max_groups)
+      {
+        std::stable_sort(data.begin(), data.end());
+        return;
+      }
+      group = group_ids.emplace(data[i].key1, first_of_group.size()).first;
+      first_of_group.push_back(i);
+    }
+    size_t key2_rank = static_cast< size_t >(data[i].key2 - CHAR_MIN);
+    entries[i] = {i, key2_rank * (max_length + 1) + data[i].key3.size(), group->second};
+  }
+
+  std::vector< size_t > group_order(first_of_group.size());
+  for (size_t i = 0; i < group_order.size(); i++)
+  {
+    group_order[i] = i;
+  }
+  std::sort(group_order.begin(), group_order.end(), [&data, &first_of_group](size_t lhs, size_t rhs)
+  {
+    return data[first_of_group[lhs]] < data[first_of_group[rhs]];
+  });
+  std::vector< size_t > group_rank(group_order.size());
+  for (size_t i = 0; i < group_order.size(); i++)
+  {
+    group_rank[group_order[i]] = i;
+  }
+  for (sort_entry &entry : entries)
+  {
+    entry.major = group_rank[entry.major];
+  }
+
+  std::vector< sort_entry > buffer(entries.size());
+  stable_count(entries, buffer, minor_buckets, false);
+  stable_count(entries, buffer, group_order.size(), true);
+
+  std::vector< DataStruct > sorted;
+  sorted.reserve(data.size());
+  for (const sort_entry &entry : entries)
+  {
+    sorted.push_back(std::move(data[entry.index]));
+  }
+  data.swap(sorted);
+}
@@ -0,0 +1,10 @@
+#ifndef COUNTING_SORT_HPP
+#define COUNTING_SORT_HPP
+#include <vector>
+#include "data_struct.hpp"
+
+namespace nehvedovich
+{
+  void countingSort(std::vector< DataStruct > &data);
+}
+#endif
@@ -3,15 +3,24 @@
 #include <algorithm>
 #include <limits>
 #include <iostream>
+#include <cstring>
 
+#include "counting_sort.hpp"
 #include "data_struct.hpp"
 
-int main()
+int main(int argc, char *argv[])
 {
   using nehvedovich::DataStruct;
   using input_it_t = std::istream_iterator< DataStruct >;
   using output_it_t = std::ostream_iterator< DataStruct >;
 
+  const bool use_counting_sort = argc == 2 && std::strcmp(argv[1], "--counting") == 0;
+  if (argc > 2 || (argc == 2 && !use_counting_sort))
+  {
+    std::cerr << "Error: expected no arguments or --counting\n";
+    return 1;
+  }
+
   std::vector< DataStruct > data;
 
   while (!std::cin.eof())
@@ -23,7 +32,14 @@ int main()
     }
   }
 
-  std::sort(data.begin(), data.end());
+  if (use_counting_sort)
+  {
+    nehvedovich::countingSort(data);
+  }
+  else
+  {
+    std::sort(data.begin(), data.end());
+  }
   std::copy(data.begin(), data.end(), output_it_t{std::cout, "\n"});
 
   return 0;
@@ -0,0 +1,82 @@
+#include "arena.h"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <new>
+
+namespace
+{
+  constexpr std::size_t BLOCK_SIZE = 1 << 20;
+}
+
+ohantsev::Arena::Arena():
+  blocks_(),
+  current_(nullptr),
+  left_(0),
+  stats_{ 0, 0, 0, 0 }
+{}
+
+ohantsev::Arena::~Arena()
+{
+  for (auto block: blocks_)
+  {
+    ::operator delete(block);
+  }
+}
+
+ohantsev::Arena& ohantsev::Arena::instance()
+{
+  static Arena arena;
+  return arena;
+}
+
+void* ohantsev::Arena::allocate(std::size_t size, std::size_t alignment)
+{
+  std::size_t padding = (alignment - reinterpret_cast< std::uintptr_t >(current_) % alignment) % alignment;
+  if (left_ < size + padding)
+  {
+    std::size_t blockSize = std::max(size, BLOCK_SIZE);
+    blocks_.reserve(blocks_.size() + 1);
+    current_ = static_cast< char* >(::operator new(blockSize));
+    blocks_.push_back(current_);
+    left_ = blockSize;
+    padding = 0;
+    ++stats_.blocks;
+  }
+  char* result = current_ + padding;
+  current_ = result + size;
+  left_ -= size + padding;
+  ++stats_.allocations;
+  stats_.bytes += size;
+  return result;
+}
+
+void ohantsev::Arena::deallocate(void* ptr, std::size_t size) noexcept
+{
+  if (static_cast< char* >(ptr) + size == current_)
+  {
+    current_ -= size;
+    left_ += size;
+    stats_.reclaimed += size;
+  }
+}
+
+const ohantsev::Arena::Stats& ohantsev::Arena::stats() const noexcept
+{
+  return stats_;
+}
+
+std::ostream& ohantsev::operator<<(std::ostream& out, const Arena::Stats& stats)
+{
+  std::ostream::sentry sentry(out);
+  if (!sentry)
+  {
+    return out;
+  }
+  out << "arena allocations: " << stats.allocations << '\n';
+  out << "heap blocks: " << stats.blocks << '\n';
+  out << "heap allocations avoided: " << stats.allocations - stats.blocks << '\n';
+  out << "bytes allocated: " << stats.bytes << '\n';
+  out << "bytes reclaimed: " << stats.reclaimed << '\n';
+  return out;
+}
@@ -0,0 +1,71 @@
+#ifndef ARENA_H
+#define ARENA_H
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ohantsev
+{
+  class Arena
+  {
+  public:
+    struct Stats
+    {
+      std::size_t allocations;
+      std::size_t reclaimed;
+      std::size_t blocks;
+      std::size_t bytes;
+    };
+
+    static Arena& instance();
+    ~Arena();
+    Arena(const Arena&) = delete;
+    Arena(Arena&&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    Arena& operator=(Arena&&) = delete;
+    void* allocate(std::size_t size, std::size_t alignment);
+    void deallocate(void* ptr, std::size_t size) noexcept;
+    const Stats& stats() const noexcept;
+  private:
+    std::vector< char* > blocks_;
+    char* current_;
+    std::size_t left_;
+    Stats stats_;
+    Arena();
+  };
+
+  template< class T >
+  struct ArenaAllocator
+  {
+    using value_type = T;
+    ArenaAllocator() = default;
+    template< class U >
+    ArenaAllocator(const ArenaAllocator< U >&) noexcept
+    {}
+    T* allocate(std::size_t count)
+    {
+      return static_cast< T* >(Arena::instance().allocate(count * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* ptr, std::size_t count) noexcept
+    {
+      Arena::instance().deallocate(ptr, count * sizeof(T));
+    }
+  };
+
+  template< class T, class U >
+  bool operator==(const ArenaAllocator< T >&, const ArenaAllocator< U >&) noexcept
+  {
+    return true;
+  }
+
+  template< class T, class U >
+  bool operator!=(const ArenaAllocator< T >&, const ArenaAllocator< U >&) noexcept
+  {
+    return false;
+  }
+
+  using ArenaString = std::basic_string< char, std::char_traits< char >, ArenaAllocator< char > >;
+
+  std::ostream& operator<<(std::ostream& out, const Arena::Stats& stats);
+}
+#endif
@@ -0,0 +1,95 @@
+#include "benchmark.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <numeric.h>
+
+namespace
+{
+  constexpr std::size_t ROUNDS = 200000;
+
+  std::size_t rejected = 0;
+
+  template< class Decode >
+  double measure(const std::vector< std::string >& tokens, Decode decode)
+  {
+    using clock = std::chrono::steady_clock;
+    auto start = clock::now();
+    for (std::size_t i = 0; i < ROUNDS; ++i)
+    {
+      rejected += decode(tokens[i % tokens.size()]) ? 0 : 1;
+    }
+    std::chrono::duration< double, std::nano > elapsed = clock::now() - start;
+    return elapsed.count() / ROUNDS;
+  }
+
+  bool isFullyDecoded(const ohantsev::DecodeResult& result, const std::string& token)
+  {
+    return result.ec == std::errc() && result.ptr == token.data() + token.size();
+  }
+}
+
+void ohantsev::benchmarkMalformedNumbers(std::ostream& out)
+{
+  const std::vector< std::string > doubles{ "abc", "e5", "1e999", "-", ".e1", "x1.5e+2", "" };
+  const std::vector< std::string > ulls{ "abc", "99999999999999999999999", "-", "ull", "x12", "" };
+  double stodTime = measure(doubles, [](const std::string& token)
+  {
+    try
+    {
+      std::size_t processed = 0;
+      std::stod(token, &processed);
+      return processed == token.size();
+    }
+    catch (...)
+    {
+      return false;
+    }
+  });
+  double decodeDoubleTime = measure(doubles, [](const std::string& token)
+  {
+    double value = 0.0;
+    return isFullyDecoded(decodeDouble(token.data(), token.data() + token.size(), value), token);
+  });
+  double stoullTime = measure(ulls, [](const std::string& token)
+  {
+    try
+    {
+      std::size_t processed = 0;
+      std::stoull(token, &processed);
+      return processed == token.size();
+    }
+    catch (...)
+    {
+      return false;
+    }
+  });
+  double decodeUllTime = measure(ulls, [](const std::string& token)
+  {
+    unsigned long long value = 0;
+    return isFullyDecoded(decodeUll(token.data(), token.data() + token.size(), value), token);
+  });
+  out << "malformed double, std::stod + catch: " << stodTime << " ns\n";
+  out << "malformed double, decodeDouble:      " << decodeDoubleTime << " ns\n";
+  out << "malformed ull, std::stoull + catch:  " << stoullTime << " ns\n";
+  out << "malformed ull, decodeUll:            " << decodeUllTime << " ns\n";
+  out << "rejected tokens: " << rejected << '\n';
+}
+
+void ohantsev::benchmarkScientific(std::ostream& out)
+{
+  const std::vector< std::string > doubles{ "1.5e+2", "-3.25E-4", "9.99e10", "0.001e3", "123456.789e-2", "7e0" };
+  double strtodTime = measure(doubles, [](const std::string& token)
+  {
+    double value = 0.0;
+    return isFullyDecoded(decodeDouble(token.data(), token.data() + token.size(), value), token);
+  });
+  double scientificTime = measure(doubles, [](const std::string& token)
+  {
+    double value = 0.0;
+    return isFullyDecoded(decodeScientific(token.data(), token.data() + token.size(), value), token);
+  });
+  out << "scientific double, decodeDouble:     " << strtodTime << " ns\n";
+  out << "scientific double, decodeScientific: " << scientificTime << " ns\n";
+}
@@ -0,0 +1,10 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+#include <iosfwd>
+
+namespace ohantsev
+{
+  void benchmarkMalformedNumbers(std::ostream& out);
+  void benchmarkScientific(std::ostream& out);
+}
+#endif
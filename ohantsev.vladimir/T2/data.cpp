@@ -5,6 +5,7 @@
 #include <cctype>
 #include <delimiter.h>
 #include <iofmtguard.h>
+#include <numeric.h>
 
 std::istream& ohantsev::operator>>(std::istream& in, MultDelimiterIO&& dest)
 {
@@ -35,30 +36,9 @@ std::istream& ohantsev::operator>>(std::istream& in, DoubleI&& dest)
   }
   std::string numberStr;
   std::getline(in, numberStr, ':');
-  bool hasExponent = false;
-  for (auto chr: numberStr)
-  {
-    if (chr == 'e' || chr == 'E')
-    {
-      hasExponent = true;
-      break;
-    }
-  }
-  if (!hasExponent)
-  {
-    in.setstate(std::ios::failbit);
-    return in;
-  }
-  try
-  {
-    std::size_t processedCount;
-    dest.ref = std::stod(numberStr, &processedCount);
-    if (processedCount < numberStr.size())
-    {
-      in.setstate(std::ios::failbit);
-    }
-  }
-  catch (...)
+  const char* numberEnd = numberStr.data() + numberStr.size();
+  DecodeResult result = decodeScientific(numberStr.data(), numberEnd, dest.ref);
+  if (result.ec != std::errc() || result.ptr < numberEnd)
   {
     in.setstate(std::ios::failbit);
   }
@@ -80,16 +60,9 @@ std::istream& ohantsev::operator>>(std::istream& in, UllI&& dest)
     in.setstate(std::ios::failbit);
     return in;
   }
-  try
-  {
-    std::size_t processedCount;
-    dest.ref = std::stoull(ull, &processedCount);
-    if (processedCount < ull.size() - SUFFIX_LENGTH)
-    {
-      in.setstate(std::ios::failbit);
-    }
-  }
-  catch (...)
+  const char* ullEnd = ull.data() + ull.size();
+  DecodeResult result = decodeUll(ull.data(), ullEnd, dest.ref);
+  if (result.ec != std::errc() || result.ptr < ullEnd - SUFFIX_LENGTH)
   {
     in.setstate(std::ios::failbit);
   }
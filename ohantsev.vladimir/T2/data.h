@@ -3,6 +3,7 @@
 #include <iosfwd>
 #include <string>
 #include <array>
+#include "arena.h"
 
 namespace ohantsev
 {
@@ -10,7 +11,7 @@ namespace ohantsev
   {
     double key1;
     unsigned long long key2;
-    std::string key3;
+    ArenaString key3;
     bool operator<(const DataStruct& rhs) const noexcept;
     static constexpr std::size_t FIELDS_COUNT = 3;
     enum class KeyID
@@ -48,12 +49,12 @@ namespace ohantsev
 
   struct StringI
   {
-    std::string& ref;
+    ArenaString& ref;
   };
 
   struct StringO
   {
-    const std::string& ref;
+    const ArenaString& ref;
   };
 
   struct LabelIO
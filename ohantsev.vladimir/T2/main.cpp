@@ -1,16 +1,31 @@
 #include <iostream>
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <limits>
 #include <vector>
 #include "data.h"
+#include "benchmark.h"
 
-int main()
+int main(int argc, char* argv[])
 {
   using ohantsev::DataStruct;
   using inIter = std::istream_iterator< DataStruct >;
   using outIter = std::ostream_iterator< DataStruct >;
 
+  if ((argc == 2) && (std::strcmp(argv[1], "--bench") == 0))
+  {
+    ohantsev::benchmarkMalformedNumbers(std::cout);
+    ohantsev::benchmarkScientific(std::cout);
+    return 0;
+  }
+  bool showArenaStats = (argc == 2) && (std::strcmp(argv[1], "--arena-stats") == 0);
+  if (argc != 1 && !showArenaStats)
+  {
+    std::cerr << "<INVALID PARAMETERS>\n";
+    return 1;
+  }
+
   std::vector< DataStruct > data;
   while (!std::cin.eof())
   {
@@ -23,5 +38,9 @@ int main()
   }
   std::sort(data.begin(), data.end());
   std::copy(std::begin(data), std::end(data), outIter(std::cout, "\n"));
+  if (showArenaStats)
+  {
+    std::cerr << ohantsev::Arena::instance().stats();
+  }
   return 0;
 }
@@ -0,0 +1,276 @@
+#include "numeric.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+namespace
+{
+  constexpr std::size_t STACK_DIGITS = 128;
+
+  bool isSpace(char c) noexcept
+  {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+  }
+
+  int digitValue(char c) noexcept
+  {
+    if (c >= '0' && c <= '9')
+    {
+      return c - '0';
+    }
+    if (c >= 'a' && c <= 'z')
+    {
+      return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'Z')
+    {
+      return c - 'A' + 10;
+    }
+    return std::numeric_limits< int >::max();
+  }
+
+  constexpr std::uint64_t MAX_EXACT_MANTISSA = 1ull << 53;
+  constexpr int MAX_EXACT_POWER = 22;
+  constexpr int MAX_EXPONENT_DIGITS_VALUE = 100000;
+  constexpr int MAX_MANTISSA_DIGITS = 19;
+  constexpr double EXACT_POWERS[MAX_EXACT_POWER + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+
+  bool isDigit(char c) noexcept
+  {
+    return c >= '0' && c <= '9';
+  }
+
+  void accumulateDigit(char c, std::uint64_t& mantissa, int& digitCount, int& droppedDigits) noexcept
+  {
+    if (mantissa == 0 && c == '0')
+    {
+      return;
+    }
+    if (digitCount == MAX_MANTISSA_DIGITS)
+    {
+      ++droppedDigits;
+      return;
+    }
+    mantissa = mantissa * 10 + static_cast< std::uint64_t >(c - '0');
+    ++digitCount;
+  }
+
+  struct Magnitude
+  {
+    const char* ptr;
+    unsigned long long value;
+    bool isNegative;
+    bool isOverflow;
+  };
+
+  Magnitude decodeMagnitude(const char* begin, const char* end, int base) noexcept
+  {
+    const char* pos = begin;
+    while (pos != end && isSpace(*pos))
+    {
+      ++pos;
+    }
+    Magnitude result{ begin, 0, false, false };
+    if (pos != end && (*pos == '+' || *pos == '-'))
+    {
+      result.isNegative = *pos == '-';
+      ++pos;
+    }
+    bool hasPrefix = base == 16 && end - pos > 2 && pos[0] == '0' && (pos[1] == 'x' || pos[1] == 'X');
+    if (hasPrefix && digitValue(pos[2]) < base)
+    {
+      pos += 2;
+    }
+    const unsigned long long limit = std::numeric_limits< unsigned long long >::max();
+    const char* digits = pos;
+    for (int digit = 0; pos != end && (digit = digitValue(*pos)) < base; ++pos)
+    {
+      unsigned long long udigit = static_cast< unsigned long long >(digit);
+      if (result.value > (limit - udigit) / static_cast< unsigned long long >(base))
+      {
+        result.isOverflow = true;
+      }
+      result.value = result.value * base + udigit;
+    }
+    if (pos != digits)
+    {
+      result.ptr = pos;
+    }
+    return result;
+  }
+}
+
+namespace
+{
+  ohantsev::DecodeResult decodeExponentDouble(const char* begin, const char* end, double& value) noexcept
+  {
+    double result = 0.0;
+    ohantsev::DecodeResult decoded = ohantsev::decodeDouble(begin, end, result);
+    if (decoded.ec != std::errc())
+    {
+      return decoded;
+    }
+    if (std::find_if(begin, decoded.ptr, [](char c) { return c == 'e' || c == 'E'; }) == decoded.ptr)
+    {
+      return { decoded.ptr, std::errc::invalid_argument };
+    }
+    value = result;
+    return decoded;
+  }
+}
+
+ohantsev::DecodeResult ohantsev::decodeDouble(const char* begin, const char* end, double& value) noexcept
+{
+  std::size_t size = static_cast< std::size_t >(end - begin);
+  char stackDigits[STACK_DIGITS];
+  std::unique_ptr< char[] > heapDigits;
+  char* digits = stackDigits;
+  if (size >= STACK_DIGITS)
+  {
+    heapDigits.reset(new (std::nothrow) char[size + 1]);
+    if (!heapDigits)
+    {
+      return { begin, std::errc::not_enough_memory };
+    }
+    digits = heapDigits.get();
+  }
+  std::memcpy(digits, begin, size);
+  digits[size] = '\0';
+  char* last = nullptr;
+  int savedErrno = errno;
+  errno = 0;
+  double result = std::strtod(digits, &last);
+  bool isOutOfRange = errno == ERANGE;
+  errno = savedErrno;
+  if (last == digits)
+  {
+    return { begin, std::errc::invalid_argument };
+  }
+  const char* ptr = begin + (last - digits);
+  if (isOutOfRange)
+  {
+    return { ptr, std::errc::result_out_of_range };
+  }
+  value = result;
+  return { ptr, std::errc() };
+}
+
+ohantsev::DecodeResult ohantsev::decodeScientific(const char* begin, const char* end, double& value) noexcept
+{
+  const char* pos = begin;
+  while (pos != end && isSpace(*pos))
+  {
+    ++pos;
+  }
+  bool isNegative = false;
+  if (pos != end && (*pos == '+' || *pos == '-'))
+  {
+    isNegative = *pos == '-';
+    ++pos;
+  }
+  bool isHex = end - pos >= 2 && pos[0] == '0' && (pos[1] == 'x' || pos[1] == 'X');
+  if (pos == end || isHex || (!isDigit(*pos) && *pos != '.'))
+  {
+    return decodeExponentDouble(begin, end, value);
+  }
+  std::uint64_t mantissa = 0;
+  int digitCount = 0;
+  int droppedDigits = 0;
+  int fractionDigits = 0;
+  bool hasDigits = false;
+  for (; pos != end && isDigit(*pos); ++pos)
+  {
+    accumulateDigit(*pos, mantissa, digitCount, droppedDigits);
+    hasDigits = true;
+  }
+  if (pos != end && *pos == '.')
+  {
+    for (++pos; pos != end && isDigit(*pos); ++pos)
+    {
+      accumulateDigit(*pos, mantissa, digitCount, droppedDigits);
+      ++fractionDigits;
+      hasDigits = true;
+    }
+  }
+  if (!hasDigits)
+  {
+    return { begin, std::errc::invalid_argument };
+  }
+  const char* exponentStart = pos;
+  if (pos == end || (*pos != 'e' && *pos != 'E'))
+  {
+    return { pos, std::errc::invalid_argument };
+  }
+  ++pos;
+  bool isExponentNegative = false;
+  if (pos != end && (*pos == '+' || *pos == '-'))
+  {
+    isExponentNegative = *pos == '-';
+    ++pos;
+  }
+  if (pos == end || !isDigit(*pos))
+  {
+    return { exponentStart, std::errc::invalid_argument };
+  }
+  int exponent = 0;
+  for (; pos != end && isDigit(*pos); ++pos)
+  {
+    exponent = std::min(exponent * 10 + (*pos - '0'), MAX_EXPONENT_DIGITS_VALUE);
+  }
+  int power = (isExponentNegative ? -exponent : exponent) - fractionDigits;
+  if (droppedDigits != 0 || mantissa > MAX_EXACT_MANTISSA || power < -MAX_EXACT_POWER || power > MAX_EXACT_POWER)
+  {
+    return decodeExponentDouble(begin, end, value);
+  }
+  double result = static_cast< double >(mantissa);
+  result = power < 0 ? result / EXACT_POWERS[-power] : result * EXACT_POWERS[power];
+  value = isNegative ? -result : result;
+  return { pos, std::errc() };
+}
+
+ohantsev::DecodeResult ohantsev::decodeUll(const char* begin, const char* end, unsigned long long& value,
+  int base) noexcept
+{
+  Magnitude magnitude = decodeMagnitude(begin, end, base);
+  if (magnitude.ptr == begin)
+  {
+    return { begin, std::errc::invalid_argument };
+  }
+  if (magnitude.isOverflow)
+  {
+    return { magnitude.ptr, std::errc::result_out_of_range };
+  }
+  value = magnitude.isNegative ? 0 - magnitude.value : magnitude.value;
+  return { magnitude.ptr, std::errc() };
+}
+
+ohantsev::DecodeResult ohantsev::decodeLongLong(const char* begin, const char* end, long long& value,
+  int base) noexcept
+{
+  Magnitude magnitude = decodeMagnitude(begin, end, base);
+  if (magnitude.ptr == begin)
+  {
+    return { begin, std::errc::invalid_argument };
+  }
+  const unsigned long long maxValue = std::numeric_limits< long long >::max();
+  if (magnitude.isOverflow || magnitude.value > maxValue + (magnitude.isNegative ? 1 : 0))
+  {
+    return { magnitude.ptr, std::errc::result_out_of_range };
+  }
+  if (magnitude.isNegative)
+  {
+    value = magnitude.value == 0 ? 0 : -static_cast< long long >(magnitude.value - 1) - 1;
+  }
+  else
+  {
+    value = static_cast< long long >(magnitude.value);
+  }
+  return { magnitude.ptr, std::errc() };
+}
@@ -0,0 +1,18 @@
+#ifndef NUMERIC_H
+#define NUMERIC_H
+#include <system_error>
+
+namespace ohantsev
+{
+  struct DecodeResult
+  {
+    const char* ptr;
+    std::errc ec;
+  };
+
+  DecodeResult decodeDouble(const char* begin, const char* end, double& value) noexcept;
+  DecodeResult decodeScientific(const char* begin, const char* end, double& value) noexcept;
+  DecodeResult decodeUll(const char* begin, const char* end, unsigned long long& value, int base = 10) noexcept;
+  DecodeResult decodeLongLong(const char* begin, const char* end, long long& value, int base = 10) noexcept;
+}
+#endif
@@ -5,6 +5,24 @@
 #include "fmtguard.hpp"
 #include "skip_any_of.hpp"
 
+namespace
+{
+  constexpr char dot[] = ".";
+  constexpr char exp_lower[] = "e";
+  constexpr char exp_upper[] = "E";
+  constexpr char ll_upper[] = "LL";
+  constexpr char ll_lower[] = "ll";
+  constexpr char quote[] = "\"";
+  constexpr char open_record[] = "(";
+  constexpr char close_record[] = ":)";
+  constexpr char key1[] = ":key1";
+  constexpr char key2[] = ":key2";
+  constexpr char key3[] = ":key3";
+  constexpr char space[] = " ";
+  constexpr char tab[] = "\t";
+  constexpr char newline[] = "\n";
+}
+
 template<>
 std::istream& rychkov::iofmt::operator>>< rychkov::iofmt::scientific_literal::value_type,
       rychkov::iofmt::scientific_literal::id >(std::istream& in, scientific_literal&& wrapper)
@@ -16,8 +34,8 @@ std::istream& rychkov::iofmt::operator>>< rychkov::iofmt::scientific_literal::va
   }
   fmtguard guard(in);
   long long whole = 0, fractional = 0, exponent = 0;
-  in >> whole >> std::noskipws >> anyof(".") >> fractional;
-  if (in && (fractional >= 0) && (in >> anyof("e", "E") >> exponent))
+  in >> whole >> std::noskipws >> anyof< dot >() >> fractional;
+  if (in && (fractional >= 0) && (in >> anyof< exp_lower, exp_upper >() >> exponent))
   {
     long long temp = fractional, fracLen10 = 0;
     for (; temp != 0; temp /= 10, fracLen10++)
@@ -38,7 +56,7 @@ std::istream& rychkov::iofmt::operator>>< rychkov::iofmt::ull_literal::value_typ
   {
     return in;
   }
-  return in >> wrapper.link_ >> anyof("LL", "ll");
+  return in >> wrapper.link_ >> anyof< ll_upper, ll_lower >();
 }
 template<>
 std::istream& rychkov::iofmt::operator>>< rychkov::iofmt::string_literal::value_type,
@@ -49,7 +67,7 @@ std::istream& rychkov::iofmt::operator>>< rychkov::iofmt::string_literal::value_
   {
     return in;
   }
-  return std::getline(in >> anyof("\""), wrapper.link_, '"');
+  return std::getline(in >> anyof< quote >(), wrapper.link_, '"');
 }
 
 std::istream& rychkov::iofmt::operator>>(std::istream& in, nth_ds_field wrapper)
@@ -74,7 +92,7 @@ std::istream& rychkov::iofmt::operator>>(std::istream& in, nth_ds_field wrapper)
 std::istream& rychkov::operator>>(std::istream& in, DataStruct& link)
 {
   std::istream::sentry sentry(in);
-  if (!sentry || !(in >> iofmt::anyof("(")))
+  if (!sentry || !(in >> iofmt::anyof< open_record >()))
   {
     return in;
   }
@@ -82,14 +100,14 @@ std::istream& rychkov::operator>>(std::istream& in, DataStruct& link)
   while (!entered.full())
   {
     size_t key_id = -1;
-    if (!(in >> iofmt::anyof(&key_id, ":key1", ":key2", ":key3")) || !entered.reg(key_id))
+    if (!(in >> iofmt::anyof< key1, key2, key3 >(&key_id)) || !entered.reg(key_id))
     {}
-    else if (in >> iofmt::anyof(true, " ", "\t", "\n") >> iofmt::nth_ds_field{key_id, link})
+    else if (in >> iofmt::anyof< space, tab, newline >(true) >> iofmt::nth_ds_field{key_id, link})
     {
       continue;
     }
     in.setstate(std::ios::failbit);
     return in;
   }
-  return in >> iofmt::anyof(":)");
+  return in >> iofmt::anyof< close_record >();
 }
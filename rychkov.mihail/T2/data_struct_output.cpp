@@ -4,6 +4,7 @@
 #include <cmath>
 #include "fmtguard.hpp"
 #include "skip_any_of.hpp"
+#include "scientific_format.hpp"
 
 template<>
 std::ostream& rychkov::iofmt::operator<<< rychkov::iofmt::scientific_literal::value_type,
@@ -14,9 +15,16 @@ std::ostream& rychkov::iofmt::operator<<< rychkov::iofmt::scientific_literal::va
   {
     return out;
   }
-  fmtguard guard(out);
-  int power = wrapper.link_ == 0 ? 0 : 1 + static_cast< int >(std::floor(std::log10(std::fabs(wrapper.link_)))) - 1;
-  return out << std::fixed << wrapper.link_ * std::pow(10., -power) << 'e' << std::showpos << power;
+  std::streamsize precision = out.precision();
+  if ((precision < 0) || (precision > max_scientific_precision))
+  {
+    fmtguard guard(out);
+    int power = wrapper.link_ == 0 ? 0 : 1 + static_cast< int >(std::floor(std::log10(std::fabs(wrapper.link_)))) - 1;
+    return out << std::fixed << wrapper.link_ * std::pow(10., -power) << 'e' << std::showpos << power;
+  }
+  char buffer[scientific_buffer_size];
+  size_t length = format_scientific(wrapper.link_, static_cast< int >(precision), buffer);
+  return out.write(buffer, static_cast< std::streamsize >(length));
 }
 template<>
 std::ostream& rychkov::iofmt::operator<<< rychkov::iofmt::ull_literal::value_type,
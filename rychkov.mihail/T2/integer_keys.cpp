@@ -0,0 +1,117 @@
+#include "integer_keys.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+namespace
+{
+  constexpr std::uint64_t sign_bit = std::uint64_t{1} << 63;
+  constexpr size_t digit_bits = 8;
+  constexpr size_t bucket_count = size_t{1} << digit_bits;
+  constexpr size_t digits_per_word = sizeof(std::uint64_t);
+  constexpr size_t pass_count = digits_per_word * rychkov::integer_key_width;
+  constexpr size_t min_radix_size = 64;
+
+  using histogram = std::array< size_t, bucket_count >;
+
+  size_t digit(const rychkov::integer_key& key, size_t pass) noexcept
+  {
+    std::uint64_t word = key.words[rychkov::integer_key_width - 1 - pass / digits_per_word];
+    return static_cast< size_t >(word >> (pass % digits_per_word * digit_bits)) & (bucket_count - 1);
+  }
+  void radix_sort_keys(std::vector< rychkov::integer_key >& keys)
+  {
+    const size_t size = keys.size();
+    std::vector< histogram > histograms(pass_count, histogram{});
+    for (const rychkov::integer_key& key: keys)
+    {
+      for (size_t pass = 0; pass < pass_count; pass++)
+      {
+        histograms[pass][digit(key, pass)]++;
+      }
+    }
+    std::vector< rychkov::integer_key > buffer(size);
+    for (size_t pass = 0; pass < pass_count; pass++)
+    {
+      histogram& counts = histograms[pass];
+      if (counts[digit(keys.front(), pass)] == size)
+      {
+        continue;
+      }
+      size_t offset = 0;
+      for (size_t& count: counts)
+      {
+        size_t bucket_size = count;
+        count = offset;
+        offset += bucket_size;
+      }
+      for (const rychkov::integer_key& key: keys)
+      {
+        buffer[counts[digit(key, pass)]++] = key;
+      }
+      keys.swap(buffer);
+    }
+  }
+}
+
+std::uint64_t rychkov::ordered_bits(double value) noexcept
+{
+  if (std::isnan(value))
+  {
+    return ~std::uint64_t{0};
+  }
+  if (value == 0.0)
+  {
+    value = 0.0;
+  }
+  std::uint64_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+}
+std::uint64_t rychkov::ordered_bits(long long value) noexcept
+{
+  return static_cast< std::uint64_t >(value) ^ sign_bit;
+}
+rychkov::integer_key rychkov::make_integer_key(const DataStruct& value, size_t index) noexcept
+{
+  return {{ordered_bits(value.key1), ordered_bits(value.key2), value.key3.length()}, index};
+}
+bool rychkov::operator<(const integer_key& lhs, const integer_key& rhs) noexcept
+{
+  bool less = false;
+  bool decided = false;
+  for (size_t i = 0; i < integer_key_width; i++)
+  {
+    less = less || (!decided && (lhs.words[i] < rhs.words[i]));
+    decided = decided || (lhs.words[i] != rhs.words[i]);
+  }
+  return less;
+}
+
+void rychkov::radix_sort(std::vector< DataStruct >& values)
+{
+  std::vector< integer_key > keys;
+  keys.reserve(values.size());
+  for (size_t i = 0; i < values.size(); i++)
+  {
+    keys.push_back(make_integer_key(values[i], i));
+  }
+  if (keys.size() < min_radix_size)
+  {
+    std::stable_sort(keys.begin(), keys.end());
+  }
+  else
+  {
+    radix_sort_keys(keys);
+  }
+  std::vector< DataStruct > sorted;
+  sorted.reserve(values.size());
+  for (const integer_key& key: keys)
+  {
+    sorted.push_back(std::move(values[key.index]));
+  }
+  values.swap(sorted);
+}
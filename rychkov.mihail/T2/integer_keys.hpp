@@ -0,0 +1,25 @@
+#ifndef INTEGER_KEYS_HPP
+#define INTEGER_KEYS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "data_struct.hpp"
+
+namespace rychkov
+{
+  constexpr size_t integer_key_width = 3;
+  struct integer_key
+  {
+    std::uint64_t words[integer_key_width];
+    size_t index;
+  };
+
+  std::uint64_t ordered_bits(double value) noexcept;
+  std::uint64_t ordered_bits(long long value) noexcept;
+  integer_key make_integer_key(const DataStruct& value, size_t index) noexcept;
+  bool operator<(const integer_key& lhs, const integer_key& rhs) noexcept;
+  void radix_sort(std::vector< DataStruct >& values);
+}
+
+#endif
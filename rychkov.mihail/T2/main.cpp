@@ -4,8 +4,12 @@
 #include <iterator>
 #include <limits>
 #include <iomanip>
+#include <cstdlib>
+#include <cstring>
 
 #include "data_struct.hpp"
+#include "verify_format.hpp"
+#include "integer_keys.hpp"
 
 namespace rychkov
 {
@@ -26,8 +30,19 @@ namespace rychkov
   };
 }
 
-int main()
+int main(int argc, char** argv)
 {
+  if ((argc == 3) && (std::strcmp(argv[1], "--verify-format") == 0))
+  {
+    return rychkov::verify_scientific_format(std::strtoull(argv[2], nullptr, 10), std::cout) ? 0 : 1;
+  }
+  bool use_radix = (argc == 2) && (std::strcmp(argv[1], "--radix") == 0);
+  if ((argc != 1) && !use_radix)
+  {
+    std::cerr << "invalid arguments\n";
+    return 1;
+  }
+
   using data_t = rychkov::DataStruct;
   std::vector< data_t > values;
   while (std::cin)
@@ -37,7 +52,14 @@ int main()
     std::cin.clear(std::cin.rdstate() & ~std::ios::failbit);
     std::cin.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
   }
-  std::sort(values.begin(), values.end(), rychkov::ds_compare{});
+  if (use_radix)
+  {
+    rychkov::radix_sort(values);
+  }
+  else
+  {
+    std::sort(values.begin(), values.end(), rychkov::ds_compare{});
+  }
 
   std::cout << std::setprecision(1);
   std::copy(values.begin(), values.end(), std::ostream_iterator< data_t >{std::cout, "\n"});
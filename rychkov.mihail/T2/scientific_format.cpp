@@ -0,0 +1,223 @@
+#include "scientific_format.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+namespace
+{
+  class big_uint
+  {
+  public:
+    explicit big_uint(std::uint64_t value) noexcept:
+      words_{static_cast< std::uint32_t >(value), static_cast< std::uint32_t >(value >> 32)},
+      size_(2)
+    {
+      trim();
+    }
+    void multiply(std::uint32_t factor) noexcept
+    {
+      std::uint64_t carry = 0;
+      for (size_t i = 0; i < size_; i++)
+      {
+        carry += static_cast< std::uint64_t >(words_[i]) * factor;
+        words_[i] = static_cast< std::uint32_t >(carry);
+        carry >>= 32;
+      }
+      if (carry != 0)
+      {
+        words_[size_++] = static_cast< std::uint32_t >(carry);
+      }
+    }
+    void multiply_pow10(int power) noexcept
+    {
+      for (; power >= 9; power -= 9)
+      {
+        multiply(1000000000);
+      }
+      for (; power > 0; power--)
+      {
+        multiply(10);
+      }
+    }
+    void shift_left(size_t bits) noexcept
+    {
+      size_t word_shift = bits / 32;
+      size_t bit_shift = bits % 32;
+      words_[size_ + word_shift] = 0;
+      for (size_t i = size_; i-- > 0;)
+      {
+        std::uint64_t moved = static_cast< std::uint64_t >(words_[i]) << bit_shift;
+        words_[i + word_shift + 1] |= static_cast< std::uint32_t >(moved >> 32);
+        words_[i + word_shift] = static_cast< std::uint32_t >(moved);
+      }
+      std::fill_n(words_, word_shift, 0);
+      size_ += word_shift + 1;
+      trim();
+    }
+    void subtract(const big_uint& rhs) noexcept
+    {
+      std::int64_t borrow = 0;
+      for (size_t i = 0; i < size_; i++)
+      {
+        std::int64_t diff = static_cast< std::int64_t >(words_[i]) - (i < rhs.size_ ? rhs.words_[i] : 0) - borrow;
+        borrow = diff < 0 ? 1 : 0;
+        words_[i] = static_cast< std::uint32_t >(diff + (borrow << 32));
+      }
+      trim();
+    }
+    int compare(const big_uint& rhs) const noexcept
+    {
+      if (size_ != rhs.size_)
+      {
+        return size_ < rhs.size_ ? -1 : 1;
+      }
+      for (size_t i = size_; i-- > 0;)
+      {
+        if (words_[i] != rhs.words_[i])
+        {
+          return words_[i] < rhs.words_[i] ? -1 : 1;
+        }
+      }
+      return 0;
+    }
+  private:
+    static constexpr size_t capacity = 48;
+    std::uint32_t words_[capacity];
+    size_t size_;
+    void trim() noexcept
+    {
+      while (size_ > 0 && words_[size_ - 1] == 0)
+      {
+        size_--;
+      }
+    }
+  };
+
+  int next_digit(big_uint& remainder, const big_uint& scale) noexcept
+  {
+    int digit = 0;
+    while (remainder.compare(scale) >= 0)
+    {
+      remainder.subtract(scale);
+      digit++;
+    }
+    return digit;
+  }
+
+  size_t write_exponent(int exponent, char* dest) noexcept
+  {
+    char digits[8];
+    size_t count = 0;
+    unsigned magnitude = exponent < 0 ? 0u - static_cast< unsigned >(exponent) : static_cast< unsigned >(exponent);
+    do
+    {
+      digits[count++] = static_cast< char >('0' + magnitude % 10);
+      magnitude /= 10;
+    }
+    while (magnitude != 0);
+    size_t length = 0;
+    dest[length++] = 'e';
+    dest[length++] = exponent < 0 ? '-' : '+';
+    while (count != 0)
+    {
+      dest[length++] = digits[--count];
+    }
+    return length;
+  }
+
+  size_t write_non_finite(double value, char* dest) noexcept
+  {
+    size_t length = 0;
+    if (std::signbit(value))
+    {
+      dest[length++] = '-';
+    }
+    std::memcpy(dest + length, std::isnan(value) ? "nan" : "inf", 3);
+    return length + 3 + write_exponent(0, dest + length + 3);
+  }
+}
+
+size_t rychkov::format_scientific(double value, int precision, char* dest) noexcept
+{
+  if (!std::isfinite(value))
+  {
+    return write_non_finite(value, dest);
+  }
+  size_t length = 0;
+  if (std::signbit(value))
+  {
+    dest[length++] = '-';
+    value = -value;
+  }
+  char digits[max_scientific_precision + 1];
+  const size_t digit_count = static_cast< size_t >(precision) + 1;
+  int exponent = 0;
+  if (value == 0)
+  {
+    std::fill_n(digits, digit_count, '0');
+  }
+  else
+  {
+    int binary_exponent = 0;
+    std::uint64_t mantissa = static_cast< std::uint64_t >(std::ldexp(std::frexp(value, &binary_exponent), 53));
+    binary_exponent -= 53;
+    big_uint remainder(mantissa);
+    big_uint scale(1);
+    if (binary_exponent > 0)
+    {
+      remainder.shift_left(static_cast< size_t >(binary_exponent));
+    }
+    else
+    {
+      scale.shift_left(static_cast< size_t >(-binary_exponent));
+    }
+    const double log10_2 = 0.30102999566398114;
+    exponent = static_cast< int >(std::floor((binary_exponent + 52) * log10_2));
+    if (exponent > 0)
+    {
+      scale.multiply_pow10(exponent);
+    }
+    else
+    {
+      remainder.multiply_pow10(-exponent);
+    }
+    big_uint next_scale = scale;
+    next_scale.multiply(10);
+    if (remainder.compare(next_scale) >= 0)
+    {
+      scale = next_scale;
+      exponent++;
+    }
+    for (size_t i = 0; i < digit_count; i++)
+    {
+      if (i != 0)
+      {
+        remainder.multiply(10);
+      }
+      digits[i] = static_cast< char >('0' + next_digit(remainder, scale));
+    }
+    remainder.multiply(2);
+    int order = remainder.compare(scale);
+    bool round_up = order > 0 || (order == 0 && (digits[digit_count - 1] - '0') % 2 == 1);
+    for (size_t i = digit_count; round_up && i-- > 0;)
+    {
+      round_up = digits[i] == '9';
+      digits[i] = round_up ? '0' : static_cast< char >(digits[i] + 1);
+    }
+    if (round_up)
+    {
+      digits[0] = '1';
+      exponent++;
+    }
+  }
+  dest[length++] = digits[0];
+  if (precision > 0)
+  {
+    dest[length++] = '.';
+    std::memcpy(dest + length, digits + 1, digit_count - 1);
+    length += digit_count - 1;
+  }
+  return length + write_exponent(exponent, dest + length);
+}
@@ -0,0 +1,14 @@
+#ifndef SCIENTIFIC_FORMAT_HPP
+#define SCIENTIFIC_FORMAT_HPP
+
+#include <cstddef>
+
+namespace rychkov
+{
+  constexpr int max_scientific_precision = 64;
+  constexpr size_t scientific_buffer_size = max_scientific_precision + 16;
+
+  size_t format_scientific(double value, int precision, char* dest) noexcept;
+}
+
+#endif
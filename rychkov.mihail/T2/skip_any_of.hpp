@@ -2,34 +2,156 @@
 #define SKIP_ANY_OF_HPP
 
 #include <istream>
-#include <algorithm>
-#include "fmtguard.hpp"
 
 namespace rychkov
 {
   namespace iofmt
   {
-    template< size_t... Lens >
+    constexpr size_t no_match = -1;
+
+    namespace detail
+    {
+      using case_mask = unsigned long long;
+
+      template< const char*... Cases >
+      constexpr char case_char(size_t j, size_t depth)
+      {
+        const char* const cases[] = {Cases...};
+        return cases[j][depth];
+      }
+      template< const char*... Cases >
+      constexpr case_mask same_char(case_mask candidates, size_t depth, char c)
+      {
+        case_mask result = 0;
+        for (size_t j = 0; j < sizeof...(Cases); j++)
+        {
+          if (((candidates >> j) & 1) && (case_char< Cases... >(j, depth) == c))
+          {
+            result |= case_mask{1} << j;
+          }
+        }
+        return result;
+      }
+      template< const char*... Cases >
+      constexpr size_t finished(case_mask candidates, size_t depth)
+      {
+        for (size_t j = 0; j < sizeof...(Cases); j++)
+        {
+          if (((candidates >> j) & 1) && (case_char< Cases... >(j, depth) == '\0'))
+          {
+            return j;
+          }
+        }
+        return no_match;
+      }
+      constexpr size_t lowest_case(case_mask candidates)
+      {
+        size_t result = 0;
+        for (; (candidates & 1) == 0; candidates >>= 1, result++)
+        {}
+        return result;
+      }
+
+      template< size_t Depth, case_mask Alive, bool IsFinished, const char*... Cases >
+      struct trie_node;
+
+      template< size_t Depth, case_mask Pending, const char*... Cases >
+      struct trie_branch
+      {
+        static constexpr char label = case_char< Cases... >(lowest_case(Pending), Depth);
+        static constexpr case_mask child = same_char< Cases... >(Pending, Depth, label);
+        static constexpr bool is_leaf = finished< Cases... >(child, Depth + 1) != no_match;
+
+        template< class Source >
+        static size_t match(char c, Source& source)
+        {
+          if (c == label)
+          {
+            return trie_node< Depth + 1, child, is_leaf, Cases... >::match(source);
+          }
+          return trie_branch< Depth, Pending & ~child, Cases... >::match(c, source);
+        }
+      };
+      template< size_t Depth, const char*... Cases >
+      struct trie_branch< Depth, 0, Cases... >
+      {
+        template< class Source >
+        static size_t match(char, Source&)
+        {
+          return no_match;
+        }
+      };
+
+      template< size_t Depth, case_mask Alive, bool IsFinished, const char*... Cases >
+      struct trie_node
+      {
+        template< class Source >
+        static size_t match(Source& source)
+        {
+          char c = '\0';
+          if (!source.next(c))
+          {
+            return no_match;
+          }
+          return trie_branch< Depth, Alive, Cases... >::match(c, source);
+        }
+      };
+      template< size_t Depth, case_mask Alive, const char*... Cases >
+      struct trie_node< Depth, Alive, true, Cases... >
+      {
+        template< class Source >
+        static size_t match(Source&)
+        {
+          return finished< Cases... >(Alive, Depth);
+        }
+      };
+
+      template< const char*... Cases >
+      constexpr bool has_empty()
+      {
+        return finished< Cases... >(~case_mask{0} >> (64 - sizeof...(Cases)), 0) != no_match;
+      }
+      template< const char*... Cases, class Source >
+      size_t match_trie(Source& source)
+      {
+        static_assert((sizeof...(Cases) > 0) && (sizeof...(Cases) <= 64), "unsupported number of cases");
+        constexpr case_mask all = ~case_mask{0} >> (64 - sizeof...(Cases));
+        return trie_node< 0, all, false, Cases... >::match(source);
+      }
+
+      class stream_source
+      {
+      public:
+        explicit stream_source(std::istream& in):
+          in_(in)
+        {}
+        bool next(char& c)
+        {
+          using traits = std::istream::traits_type;
+          traits::int_type got = in_.rdbuf()->sbumpc();
+          if (traits::eq_int_type(got, traits::eof()))
+          {
+            in_.setstate(std::ios::eofbit | std::ios::failbit);
+            return false;
+          }
+          c = traits::to_char_type(got);
+          return true;
+        }
+      private:
+        std::istream& in_;
+      };
+    }
+
+    template< const char*... Cases >
     struct match_any
     {
-      const char* cases[sizeof...(Lens)];
       bool noskipws = false;
-      size_t* result_match;
-      char* buffer;
-      match_any(const char(&... strings)[Lens], bool add_noskipws = false,
-          size_t* result_match_p = nullptr, char* buf_p = nullptr):
-        cases{strings...},
-        noskipws(add_noskipws),
-        result_match(result_match_p),
-        buffer(buf_p)
-      {}
+      size_t* result_match = nullptr;
     };
-    template< size_t... Lens >
-    std::istream& operator>>(std::istream& in, const match_any< Lens... >& possible)
+    template< const char*... Cases >
+    std::istream& operator>>(std::istream& in, const match_any< Cases... >& possible)
     {
-      constexpr size_t min_len = std::min({Lens...});
-      constexpr size_t max_len = std::max({Lens...});
-      if (min_len <= 1)
+      if (detail::has_empty< Cases... >())
       {
         return in;
       }
@@ -38,69 +160,28 @@ namespace rychkov
       {
         return in;
       }
-      fmtguard guard(in);
-
-      char static_buffer[max_len]{};
-      char* buffer = (possible.buffer == nullptr ? static_buffer : possible.buffer);
-      bool skips[sizeof...(Lens)]{};
-      constexpr size_t lens[] = {Lens...};
-      bool atleast_one = true;
-      for (size_t i = 0; atleast_one && (i + 1 < max_len) && in.get(buffer[i]); i++)
+      detail::stream_source source(in);
+      size_t match = detail::match_trie< Cases... >(source);
+      if (possible.result_match != nullptr)
       {
-        atleast_one = false;
-        for (size_t j = 0; j < sizeof...(Lens); j++)
-        {
-          if (!skips[j])
-          {
-            if ((i + 1 >= lens[j]) || (buffer[i] != possible.cases[j][i]))
-            {
-              skips[j] = true;
-              continue;
-            }
-            else if (i + 2 == lens[j])
-            {
-              if (possible.result_match != nullptr)
-              {
-                *possible.result_match = j;
-              }
-              return in;
-            }
-            atleast_one = true;
-          }
-        }
+        *possible.result_match = match;
       }
-      if (possible.result_match != nullptr)
+      if (match == no_match)
       {
-        *possible.result_match = -1;
+        in.setstate(std::ios::failbit);
       }
-      in.setstate(std::ios::failbit);
       return in;
     }
 
-    template< size_t... Lens >
-    match_any< Lens... > anyof(const char(&... strings)[Lens])
-    {
-      return {strings...};
-    }
-    template< size_t... Lens >
-    match_any< Lens... > anyof(bool noskipws, const char(&... strings)[Lens])
-    {
-      return {strings..., noskipws};
-    }
-    template< size_t... Lens >
-    match_any< Lens... > anyof(size_t* result_match, const char(&... strings)[Lens])
-    {
-      return {strings..., false, result_match};
-    }
-    template< size_t... Lens >
-    match_any< Lens... > anyof(bool noskipws, size_t* result_match, const char(&... strings)[Lens])
+    template< const char*... Cases >
+    match_any< Cases... > anyof(bool noskipws = false, size_t* result_match = nullptr)
     {
-      return {strings..., noskipws, result_match};
+      return {noskipws, result_match};
     }
-    template< size_t... Lens >
-    match_any< Lens... > anyof(bool noskipws, size_t* result_match, char* buf, const char(&... strings)[Lens])
+    template< const char*... Cases >
+    match_any< Cases... > anyof(size_t* result_match)
     {
-      return {strings..., noskipws, result_match, buf};
+      return {false, result_match};
     }
   }
 }
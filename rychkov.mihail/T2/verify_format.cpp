@@ -0,0 +1,89 @@
+#include "verify_format.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include "scientific_format.hpp"
+
+namespace
+{
+  std::string stream_format(double value, int precision)
+  {
+    std::ostringstream out;
+    int power = value == 0 ? 0 : 1 + static_cast< int >(std::floor(std::log10(std::fabs(value)))) - 1;
+    out << std::setprecision(precision) << std::fixed << value * std::pow(10., -power) << 'e' << std::showpos << power;
+    return out.str();
+  }
+  std::string printf_format(double value, int precision)
+  {
+    char buffer[rychkov::scientific_buffer_size];
+    std::snprintf(buffer, sizeof(buffer), "%.*e", precision, value);
+    char* exponent = std::strchr(buffer, 'e');
+    int power = std::atoi(exponent + 1);
+    std::snprintf(exponent, sizeof(buffer) - (exponent - buffer), "e%+d", power);
+    return buffer;
+  }
+  std::string fast_format(double value, int precision)
+  {
+    char buffer[rychkov::scientific_buffer_size];
+    return std::string(buffer, rychkov::format_scientific(value, precision, buffer));
+  }
+  double random_value(std::mt19937_64& generator)
+  {
+    std::uniform_int_distribution< int > kind(0, 2);
+    switch (kind(generator))
+    {
+    case 0:
+    {
+      double value = 0;
+      do
+      {
+        std::uint64_t bits = generator();
+        std::memcpy(&value, &bits, sizeof(value));
+      }
+      while (!std::isfinite(value));
+      return value;
+    }
+    case 1:
+      return std::uniform_real_distribution< double >(-1e6, 1e6)(generator);
+    default:
+    {
+      std::uniform_int_distribution< int > digits(0, 999);
+      std::uniform_int_distribution< int > power(-30, 30);
+      return digits(generator) / 100.0 * std::pow(10., power(generator)) + 0.005;
+    }
+    }
+  }
+}
+
+bool rychkov::verify_scientific_format(size_t count, std::ostream& report)
+{
+  std::mt19937_64 generator(count);
+  size_t same_as_stream = 0;
+  size_t wrong = 0;
+  for (size_t i = 0; i < count; i++)
+  {
+    double value = random_value(generator);
+    int precision = static_cast< int >(i % 4);
+    std::string fast = fast_format(value, precision);
+    if (fast != printf_format(value, precision))
+    {
+      if (wrong++ < 10)
+      {
+        report << std::setprecision(17) << value << ": " << fast << " != " << printf_format(value, precision) << '\n';
+      }
+    }
+    same_as_stream += fast == stream_format(value, precision) ? 1 : 0;
+  }
+  report << "checked: " << count << '\n';
+  report << "not correctly rounded: " << wrong << '\n';
+  report << "same as stream formatter: " << same_as_stream << '\n';
+  return wrong == 0;
+}
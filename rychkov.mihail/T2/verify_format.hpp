@@ -0,0 +1,12 @@
+#ifndef VERIFY_FORMAT_HPP
+#define VERIFY_FORMAT_HPP
+
+#include <cstddef>
+#include <iosfwd>
+
+namespace rychkov
+{
+  bool verify_scientific_format(size_t count, std::ostream& report);
+}
+
+#endif
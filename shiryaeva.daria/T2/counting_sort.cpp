@@ -0,0 +1,114 @@
+#include "counting_sort.hpp"
+#include <algorithm>
+#include <climits>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+  const size_t CHAR_COUNT = UCHAR_MAX + 1;
+  const size_t MIN_GROUP_SIZE = 64;
+
+  template< class Key >
+  void distribute(std::vector< size_t > &order, std::vector< size_t > &buffer,
+    size_t begin, size_t end, size_t buckets, Key key)
+  {
+    std::vector< size_t > counts(buckets + 1, 0);
+    for (size_t i = begin; i < end; ++i)
+    {
+      ++counts[key(order[i]) + 1];
+    }
+    counts[0] = begin;
+    for (size_t i = 0; i < buckets; ++i)
+    {
+      counts[i + 1] += counts[i];
+    }
+    for (size_t i = begin; i < end; ++i)
+    {
+      buffer[counts[key(order[i])]++] = order[i];
+    }
+    std::copy(buffer.begin() + begin, buffer.begin() + end, order.begin() + begin);
+  }
+}
+
+void shiryaeva::countingSort(std::vector< DataStruct > &data)
+{
+  const size_t maxGroups = data.size() / MIN_GROUP_SIZE + 1;
+  std::unordered_map< unsigned long long, size_t > groupIds;
+  std::vector< size_t > heads;
+  std::vector< size_t > groups(data.size());
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    auto found = groupIds.find(data[i].key1);
+    if (found == groupIds.end())
+    {
+      if (heads.size() == maxGroups)
+      {
+        std::stable_sort(data.begin(), data.end());
+        return;
+      }
+      found = groupIds.emplace(data[i].key1, heads.size()).first;
+      heads.push_back(i);
+    }
+    groups[i] = found->second;
+  }
+
+  std::vector< size_t > ranked(heads.size());
+  for (size_t i = 0; i < ranked.size(); ++i)
+  {
+    ranked[i] = i;
+  }
+  std::sort(ranked.begin(), ranked.end(), [&data, &heads](size_t lhs, size_t rhs)
+  {
+    return data[heads[lhs]] < data[heads[rhs]];
+  });
+  std::vector< size_t > ranks(ranked.size());
+  for (size_t i = 0; i < ranked.size(); ++i)
+  {
+    ranks[ranked[i]] = i;
+  }
+
+  std::vector< size_t > order(data.size());
+  std::vector< size_t > buffer(data.size());
+  for (size_t i = 0; i < order.size(); ++i)
+  {
+    order[i] = i;
+  }
+  distribute(order, buffer, 0, order.size(), ranked.size(), [&groups, &ranks](size_t i)
+  {
+    return ranks[groups[i]];
+  });
+
+  size_t begin = 0;
+  while (begin < order.size())
+  {
+    const unsigned long long key1 = data[order[begin]].key1;
+    size_t end = begin;
+    size_t maxLength = 0;
+    while (end < order.size() && data[order[end]].key1 == key1)
+    {
+      maxLength = std::max(maxLength, data[order[end]].key3.length());
+      ++end;
+    }
+    if (end - begin > 1)
+    {
+      distribute(order, buffer, begin, end, maxLength + 1, [&data](size_t i)
+      {
+        return data[i].key3.length();
+      });
+      distribute(order, buffer, begin, end, CHAR_COUNT, [&data](size_t i)
+      {
+        return static_cast< size_t >(data[i].key2 - CHAR_MIN);
+      });
+    }
+    begin = end;
+  }
+
+  std::vector< DataStruct > sorted;
+  sorted.reserve(data.size());
+  for (size_t i = 0; i < order.size(); ++i)
+  {
+    sorted.push_back(std::move(data[order[i]]));
+  }
+  data.swap(sorted);
+}
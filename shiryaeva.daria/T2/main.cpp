@@ -1,13 +1,26 @@
 #include "data_struct.hpp"
+#include "counting_sort.hpp"
+#include <cstring>
 #include <iostream>
 #include <iterator>
 #include <vector>
 #include <algorithm>
 #include <limits>
 
-int main()
+int main(int argc, char *argv[])
 {
   using namespace shiryaeva;
+  bool isCounting = false;
+  for (int i = 1; i < argc; ++i)
+  {
+    if (isCounting || std::strcmp(argv[i], "--counting") != 0)
+    {
+      std::cerr << "Invalid argument: " << argv[i] << '\n';
+      return 1;
+    }
+    isCounting = true;
+  }
+
   std::vector< DataStruct > data;
 
   while (!std::cin.eof())
@@ -28,7 +41,14 @@ int main()
     return 0;
   }
 
-  std::sort(data.begin(), data.end());
+  if (isCounting)
+  {
+    countingSort(data);
+  }
+  else
+  {
+    std::sort(data.begin(), data.end());
+  }
   using OutIter = std::ostream_iterator< DataStruct >;
   OutIter out(std::cout, "\n");
   std::copy(data.begin(), data.end(), out);